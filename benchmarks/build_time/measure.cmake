@@ -0,0 +1,73 @@
+# MIT License
+# 
+# Copyright (c) 2025 Mr. Myxa
+# 
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+# Compares clean build times of the generated build_time targets.
+#
+# usage: cmake -DBUILD_DIR=<configured build dir with TUPLEX_BUILD_BENCHMARKS=ON> [-DJOBS=<n>]
+#              -P benchmarks/build_time/measure.cmake
+
+cmake_minimum_required(VERSION 3.28)
+
+if(NOT BUILD_DIR)
+    message(FATAL_ERROR "BUILD_DIR is not set")
+endif()
+
+if(NOT EXISTS ${BUILD_DIR}/CMakeCache.txt)
+    message(FATAL_ERROR "${BUILD_DIR} is not a configured build directory")
+endif()
+
+load_cache(${BUILD_DIR} READ_WITH_PREFIX CACHE_ TUPLEX_BUILD_BENCHMARKS TUPLEX_BUILD_MODULE)
+
+if(NOT CACHE_TUPLEX_BUILD_BENCHMARKS)
+    message(FATAL_ERROR "${BUILD_DIR} is configured without TUPLEX_BUILD_BENCHMARKS")
+endif()
+
+if(NOT JOBS)
+    cmake_host_system_information(RESULT JOBS QUERY NUMBER_OF_LOGICAL_CORES)
+endif()
+
+set(targets build_time_includes build_time_pch)
+if(CACHE_TUPLEX_BUILD_MODULE)
+    list(APPEND targets build_time_modules)
+else()
+    message(STATUS "build_time_modules: skipped (TUPLEX_BUILD_MODULE is off)")
+endif()
+
+foreach(target ${targets})
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target clean
+                    OUTPUT_QUIET)
+
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target ${target} -j ${JOBS}
+                    RESULT_VARIABLE result
+                    OUTPUT_VARIABLE output
+                    ERROR_VARIABLE output)
+    string(TIMESTAMP stop "%s%f")
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${target} failed to build:\n${output}")
+    endif()
+
+    math(EXPR elapsed_ms "(${stop} - ${start}) / 1000")
+    message(STATUS "${target}: ${elapsed_ms} ms")
+endforeach()
@@ -0,0 +1,181 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_join.hpp"
+
+// joins a build relation of unique keys with a probe relation whose keys follow a zipf
+// distribution, with std::unordered_multimap on one thread and with hash_join on pools of
+// 1, 2, 4, ... hardware_concurrency threads. the calling thread runs jobs as well, so a pool of N
+// keeps N + 1 threads busy.
+//
+// usage: hash_join_bench [build rows] [probe rows] [zipf exponent] [repetitions]
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    using build_row = tuplex::tuple<std::uint64_t, std::uint64_t>;  // key, payload
+    using probe_row = tuplex::tuple<std::uint32_t, std::uint64_t>;  // payload, key
+    using joined_row = tuplex::cat_types_t<build_row, probe_row>;
+
+    std::vector<build_row> make_build(std::size_t rows)
+    {
+        std::mt19937_64 gen{ 1 };
+
+        std::vector<build_row> build{};
+        build.reserve(rows);
+
+        for (std::size_t i{}; i < rows; ++i)
+        {
+            build.emplace_back(gen(), i);
+        }
+
+        return build;
+    }
+
+    // rank k of the build keys is drawn with probability proportional to 1 / k^exponent
+    std::vector<probe_row> make_probe(const std::vector<build_row>& build, std::size_t rows, double exponent)
+    {
+        std::vector<double> cdf(build.size());
+
+        double sum{};
+        for (std::size_t k{}; k < build.size(); ++k)
+        {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+            cdf[k] = sum;
+        }
+
+        std::mt19937_64 gen{ 2 };
+        std::uniform_real_distribution<double> dist{ 0.0, sum };
+
+        std::vector<probe_row> probe{};
+        probe.reserve(rows);
+
+        for (std::size_t i{}; i < rows; ++i)
+        {
+            const auto rank{ std::min<std::size_t>(
+                static_cast<std::size_t>(std::lower_bound(cdf.begin(), cdf.end(), dist(gen)) - cdf.begin()), build.size() - 1) };
+            probe.emplace_back(static_cast<std::uint32_t>(i), tuplex::get<0>(build[rank]));
+        }
+
+        return probe;
+    }
+
+    std::vector<joined_row> multimap_join(const std::vector<build_row>& build, const std::vector<probe_row>& probe)
+    {
+        std::unordered_multimap<std::uint64_t, std::size_t> table{};
+        table.reserve(build.size());
+
+        for (std::size_t i{}; i < build.size(); ++i)
+        {
+            table.emplace(tuplex::get<0>(build[i]), i);
+        }
+
+        std::vector<joined_row> result{};
+
+        for (const auto& r : probe)
+        {
+            const auto [first, last]{ table.equal_range(tuplex::get<1>(r)) };
+
+            for (auto it{ first }; it != last; ++it)
+            {
+                const auto& l{ build[it->second] };
+                result.emplace_back(tuplex::get<0>(l), tuplex::get<1>(l), tuplex::get<0>(r), tuplex::get<1>(r));
+            }
+        }
+
+        return result;
+    }
+
+    template <typename Fn>
+    double best_of(std::size_t repetitions, Fn&& fn)
+    {
+        double best{ 1e300 };
+
+        for (std::size_t i{}; i < repetitions; ++i)
+        {
+            const auto start{ clock_type::now() };
+            fn();
+            const auto stop{ clock_type::now() };
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t build_rows{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000 };
+    const std::size_t probe_rows{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10'000'000 };
+    const double exponent{ argc > 3 ? std::strtod(argv[3], nullptr) : 1.0 };
+    const std::size_t repetitions{ argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 3 };
+
+    const auto build{ make_build(std::max<std::size_t>(build_rows, 1)) };
+    const auto probe{ make_probe(build, probe_rows, exponent) };
+
+    std::size_t matches{};
+    const double baseline{ best_of(repetitions, [&] { matches = multimap_join(build, probe).size(); }) };
+
+    std::cout << std::format("{} x {} rows, zipf {}, {} matches, best of {}, milliseconds\n",
+                             build.size(), probe.size(), exponent, matches, repetitions);
+    std::cout << std::format("{:>13} {:>12} {:>10}\n", "pool + caller", "time", "speedup");
+    std::cout << std::format("{:>13} {:>12.1f} {:>10.2f}\n", "multimap", baseline, 1.0);
+
+    const std::size_t hardware{ std::max<std::size_t>(std::thread::hardware_concurrency(), 1) };
+
+    std::vector<std::size_t> thread_counts{};
+    for (std::size_t threads{ 1 }; threads < hardware; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(hardware);
+
+    for (const std::size_t threads : thread_counts)
+    {
+        tuplex::thread_pool pool{ threads };
+
+        const double elapsed{ best_of(repetitions, [&]
+        {
+            static_cast<void>(tuplex::hash_join<tuplex::keys<0>, tuplex::keys<1>>(build, probe, pool));
+        }) };
+        std::cout << std::format("{:>13} {:>12.1f} {:>10.2f}\n", std::format("{} + 1", threads), elapsed, baseline / elapsed);
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_parallel.hpp"
+
+// rebuilds (copies and sorts) every shard of an 8 element tuple, one after another and with
+// parallel_transform on pools of 1, 2, 4, ... hardware_concurrency threads. the calling thread
+// runs jobs as well, so a pool of N keeps N + 1 threads busy.
+//
+// usage: parallel_bench [elements per shard] [repetitions]
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    template <typename T>
+    std::vector<T> make_shard(std::size_t size, std::uint32_t seed)
+    {
+        std::mt19937_64 gen{ seed };
+        std::uniform_int_distribution<std::uint32_t> dist{};
+
+        std::vector<T> shard(size);
+        std::generate(shard.begin(), shard.end(), [&] { return static_cast<T>(dist(gen)); });
+
+        return shard;
+    }
+
+    constexpr auto rebuild{ []<typename T>(const std::vector<T>& shard)
+    {
+        std::vector<T> sorted{ shard };
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    } };
+
+    template <typename Tp, std::size_t... Indices>
+    auto sequential(const Tp& tp, std::index_sequence<Indices...>)
+    {
+        return tuplex::tuple<std::remove_cvref_t<decltype(tuplex::get<Indices>(tp))>...>{ rebuild(tuplex::get<Indices>(tp))... };
+    }
+
+    template <typename Fn>
+    double best_of(std::size_t repetitions, Fn&& fn)
+    {
+        double best{ 1e300 };
+
+        for (std::size_t i{}; i < repetitions; ++i)
+        {
+            const auto start{ clock_type::now() };
+            fn();
+            const auto stop{ clock_type::now() };
+
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t size{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2'000'000 };
+    const std::size_t repetitions{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5 };
+
+    const tuplex::tuple<std::vector<std::uint32_t>, std::vector<std::uint64_t>, std::vector<double>, std::vector<float>,
+                        std::vector<std::uint32_t>, std::vector<std::uint64_t>, std::vector<double>, std::vector<float>> shards{
+        make_shard<std::uint32_t>(size, 1), make_shard<std::uint64_t>(size, 2), make_shard<double>(size, 3), make_shard<float>(size, 4),
+        make_shard<std::uint32_t>(size, 5), make_shard<std::uint64_t>(size, 6), make_shard<double>(size, 7), make_shard<float>(size, 8)
+    };
+
+    using indices = std::make_index_sequence<tuplex::tuple_size_v<std::remove_cvref_t<decltype(shards)>>>;
+
+    const double baseline{ best_of(repetitions, [&] { static_cast<void>(sequential(shards, indices{})); }) };
+
+    std::cout << std::format("8 shards x {} elements, best of {}, milliseconds\n", size, repetitions);
+    std::cout << std::format("{:>13} {:>12} {:>10}\n", "pool + caller", "time", "speedup");
+    std::cout << std::format("{:>13} {:>12.1f} {:>10.2f}\n", "sequential", baseline, 1.0);
+
+    const std::size_t hardware{ std::max<std::size_t>(std::thread::hardware_concurrency(), 1) };
+
+    std::vector<std::size_t> thread_counts{};
+    for (std::size_t threads{ 1 }; threads < hardware; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(hardware);
+
+    for (const std::size_t threads : thread_counts)
+    {
+        tuplex::thread_pool pool{ threads };
+
+        const double elapsed{ best_of(repetitions, [&] { static_cast<void>(tuplex::parallel_transform(shards, rebuild, pool)); }) };
+        std::cout << std::format("{:>13} {:>12.1f} {:>10.2f}\n", std::format("{} + 1", threads), elapsed, baseline / elapsed);
+    }
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <format>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_task.hpp"
+
+// latency of co_await when_all over N trivial children, frames from the heap vs from an arena
+//
+// usage: when_all_bench [iterations] [threads]
+
+namespace
+{
+    using clock_type = std::chrono::steady_clock;
+
+    tuplex::task<std::size_t> leaf(std::allocator_arg_t, std::pmr::memory_resource*, std::size_t value)
+    {
+        co_return value;
+    }
+
+    template <std::size_t... Indices>
+    tuplex::task<std::size_t> fan_out(std::allocator_arg_t, std::pmr::memory_resource* resource,
+                                      tuplex::thread_pool& pool, std::index_sequence<Indices...>)
+    {
+        auto res{ co_await tuplex::when_all(pool, leaf(std::allocator_arg, resource, Indices)...) };
+        co_return (tuplex::get<Indices>(res) + ...);
+    }
+
+    struct percentiles
+    {
+        double p50;
+        double p99;
+    };
+
+    template <std::size_t N>
+    percentiles measure(tuplex::thread_pool& pool, std::size_t iterations, bool use_arena)
+    {
+        std::vector<double> samples(iterations);
+        std::array<std::byte, 64 * 1024> buffer{};
+
+        for (auto& sample : samples)
+        {
+            std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size() };
+            std::pmr::memory_resource* resource{ use_arena ? &arena : nullptr };
+
+            const auto start{ clock_type::now() };
+            const auto sum{ tuplex::sync_wait(fan_out(std::allocator_arg, resource, pool, std::make_index_sequence<N>{})) };
+            const auto stop{ clock_type::now() };
+
+            if (sum != N * (N - 1) / 2)
+            {
+                std::abort();
+            }
+
+            sample = std::chrono::duration<double, std::micro>(stop - start).count();
+        }
+
+        std::sort(samples.begin(), samples.end());
+        return { samples[samples.size() / 2], samples[samples.size() * 99 / 100] };
+    }
+
+    template <std::size_t... Ns>
+    void run(tuplex::thread_pool& pool, std::size_t iterations, std::index_sequence<Ns...>)
+    {
+        ([&]
+        {
+            const auto heap{ measure<Ns>(pool, iterations, false) };
+            const auto arena{ measure<Ns>(pool, iterations, true) };
+
+            std::cout << std::format("{:>8} {:>12.2f} {:>12.2f} {:>12.2f} {:>12.2f}\n",
+                                     Ns, heap.p50, heap.p99, arena.p50, arena.p99);
+        }(), ...);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t iterations{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000 };
+    tuplex::thread_pool pool{ argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::thread::hardware_concurrency() };
+
+    std::cout << std::format("when_all latency, {} iterations, {} threads, microseconds\n", iterations, pool.size());
+    std::cout << std::format("{:>8} {:>12} {:>12} {:>12} {:>12}\n", "children", "heap p50", "heap p99", "arena p50", "arena p99");
+
+    run(pool, iterations, std::index_sequence<2, 4, 8, 16, 32, 64>{});
+
+    return 0;
+}
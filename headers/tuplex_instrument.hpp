@@ -0,0 +1,319 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// element copy / move / construction counters for get, make_tuple, forward_as_tuple and tuple_cat.
+// copies and moves are predicted from the argument categories, see init_counts.
+// compiled in only with TUPLEX_INSTRUMENT defined, every translation unit of a program has to agree on it.
+// get, forward_as_tuple and tuple_cat stay noexcept while recording, which inserts into a map under a
+// mutex: an instrumented build calls std::terminate when that insert fails to allocate.
+
+#ifdef TUPLEX_INSTRUMENT
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace tuplex::instrument
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    enum class operation
+    {
+        get,
+        make_tuple,
+        forward_as_tuple,
+        tuple_cat
+    };
+
+    constexpr std::string_view to_string(operation op) noexcept
+    {
+        switch (op)
+        {
+            case operation::get:              return "get";
+            case operation::make_tuple:       return "make_tuple";
+            case operation::forward_as_tuple: return "forward_as_tuple";
+            case operation::tuple_cat:        return "tuple_cat";
+        }
+        return "unknown";
+    }
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // constructions counts every element initialized from a value, copies and moves included.
+    // copies / moves are predicted, a copy-only type initialized from an rvalue shows up as a move.
+    struct counts
+    {
+        std::size_t calls{};
+        std::size_t constructions{};
+        std::size_t copies{};
+        std::size_t moves{};
+
+        constexpr counts& operator+=(const counts& rhs) noexcept
+        {
+            calls += rhs.calls;
+            constructions += rhs.constructions;
+            copies += rhs.copies;
+            moves += rhs.moves;
+            return *this;
+        }
+
+        friend constexpr counts operator+(counts lhs, const counts& rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+        friend constexpr bool operator==(const counts&, const counts&) noexcept = default;
+
+        friend std::ostream& operator<<(std::ostream& os, const counts& c)
+        {
+            return os << "calls: " << c.calls << ", constructions: " << c.constructions
+                      << ", copies: " << c.copies << ", moves: " << c.moves;
+        }
+    };
+
+    /* ------------------------------------------------------------------------------------------------ */
+    struct site
+    {
+        operation op;
+        std::string_view file;
+        std::uint_least32_t line;
+        std::uint_least32_t column;
+        std::string_view function;
+
+        friend bool operator<(const site& lhs, const site& rhs) noexcept
+        {
+            return std::tie(lhs.op, lhs.file, lhs.line, lhs.column, lhs.function) <
+                   std::tie(rhs.op, rhs.file, rhs.line, rhs.column, rhs.function);
+        }
+    };
+
+    /* ------------------------------------------------------------------------------------------------ */
+    class registry
+    {
+    public:
+        static registry& instance()
+        {
+            static registry r{};
+            return r;
+        }
+
+        void record(const site& s, const counts& c)
+        {
+            std::lock_guard lock{ mMutex };
+            mSites[s] += c;
+        }
+
+        counts total(operation op) const
+        {
+            std::lock_guard lock{ mMutex };
+
+            counts sum{};
+            for (const auto& [s, c] : mSites)
+            {
+                if (s.op == op)
+                {
+                    sum += c;
+                }
+            }
+            return sum;
+        }
+
+        template <typename Fn>
+        void for_each(Fn&& fn) const
+        {
+            std::lock_guard lock{ mMutex };
+
+            for (const auto& [s, c] : mSites)
+            {
+                fn(s, c);
+            }
+        }
+
+        void report(std::ostream& os) const
+        {
+            for_each([&os](const site& s, const counts& c)
+            {
+                if (s.file.empty())
+                {
+                    os << "(no scope)";
+                }
+                else
+                {
+                    os << s.file << ':' << s.line << ':' << s.column;
+                }
+
+                os << ' ' << to_string(s.op) << " [" << s.function << "] " << c << '\n';
+            });
+        }
+
+        void reset()
+        {
+            std::lock_guard lock{ mMutex };
+            mSites.clear();
+        }
+
+    private:
+        registry() = default;
+
+        mutable std::mutex mMutex;
+        std::map<site, counts> mSites;
+    };
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // get records its caller's location. the variadic operations can't take a defaulted
+    // std::source_location, they record the innermost scope alive on the thread. without one they
+    // are grouped per instantiation, with an empty file and line 0.
+    class scope
+    {
+    public:
+        explicit scope(std::source_location location = std::source_location::current()) noexcept :
+            mLocation{ location }, mPrevious{ std::exchange(current(), this) }
+        { }
+
+        scope(const scope&) = delete;
+        scope& operator=(const scope&) = delete;
+
+        ~scope() noexcept
+        {
+            current() = mPrevious;
+        }
+
+        static scope*& current() noexcept
+        {
+            thread_local scope* innermost{ nullptr };
+            return innermost;
+        }
+
+        const std::source_location& location() const noexcept
+        {
+            return mLocation;
+        }
+
+    private:
+        std::source_location mLocation;
+        scope* mPrevious;
+    };
+} // namespace tuplex::instrument
+
+namespace tuplex::detail
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    // what initializing an element of type T from an Arg is expected to do. this is a prediction from
+    // the argument's value category, a non-const rvalue counts as a move even when T has no move
+    // constructor and overload resolution actually picks the copy constructor.
+    template <typename T, typename Arg>
+    constexpr instrument::counts init_counts() noexcept
+    {
+        if constexpr (std::is_reference_v<T>)
+        {
+            return {};
+        }
+        else if constexpr (!std::is_same_v<std::remove_cv_t<T>, std::remove_cvref_t<Arg>>)
+        {
+            return { .constructions = 1 };
+        }
+        else if constexpr (std::is_rvalue_reference_v<Arg&&> && !std::is_const_v<std::remove_reference_t<Arg>>)
+        {
+            return { .constructions = 1, .moves = 1 };
+        }
+        else
+        {
+            return { .constructions = 1, .copies = 1 };
+        }
+    }
+
+    /* ------------------------------------------------------------------------------------------------ */
+    inline int& instrument_depth() noexcept
+    {
+        thread_local int depth{};
+        return depth;
+    }
+
+    // records only the outermost operation, tuple_cat's own get / forward_as_tuple calls stay silent
+    class instrument_call
+    {
+    public:
+        constexpr instrument_call(instrument::operation op, const std::source_location& location, instrument::counts c)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                if (instrument_depth()++ == 0)
+                {
+                    c.calls = 1;
+                    instrument::registry::instance().record(make_site(op, location), c);
+                }
+                mActive = true;
+            }
+        }
+
+        instrument_call(const instrument_call&) = delete;
+        instrument_call& operator=(const instrument_call&) = delete;
+
+        constexpr ~instrument_call() noexcept
+        {
+            if (mActive)
+            {
+                --instrument_depth();
+            }
+        }
+
+    private:
+        // location is the caller's only for get, the variadic operations pass their own instantiation's
+        static instrument::site make_site(instrument::operation op, const std::source_location& location) noexcept
+        {
+            const auto* s{ instrument::scope::current() };
+
+            if (op == instrument::operation::get)
+            {
+                return { op, location.file_name(), location.line(), location.column(), location.function_name() };
+            }
+
+            if (s != nullptr)
+            {
+                const auto& where{ s->location() };
+                return { op, where.file_name(), where.line(), where.column(), where.function_name() };
+            }
+
+            return { op, {}, 0, 0, location.function_name() };
+        }
+
+        bool mActive{};
+    };
+} // namespace tuplex::detail
+
+#define TUPLEX_INSTRUMENT_LOCATION , std::source_location tuplex_location = std::source_location::current()
+#define TUPLEX_INSTRUMENT_CALL(op, location, ...) \
+    const ::tuplex::detail::instrument_call tuplex_instrument_call{ ::tuplex::instrument::operation::op, location, __VA_ARGS__ }
+
+#else
+
+#define TUPLEX_INSTRUMENT_LOCATION
+#define TUPLEX_INSTRUMENT_CALL(op, location, ...)
+
+#endif
@@ -0,0 +1,373 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_thread_pool.hpp"
+#include "tuplex_parallel.hpp"
+
+namespace tuplex
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    // element indices a join compares, hash_join<keys<0>, keys<2>>(left, right)
+    template <std::size_t... Indices>
+    struct keys {};
+
+    namespace detail
+    {
+        /* ------------------------------------------------------------------------------------------------ */
+        // splitmix64 finalizer, std::hash of integers is the identity in most standard libraries
+        constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept
+        {
+            h ^= h >> 30;
+            h *= 0xbf58476d1ce4e5b9ULL;
+            h ^= h >> 27;
+            h *= 0x94d049bb133111ebULL;
+            h ^= h >> 31;
+            return h;
+        }
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <typename Row, std::size_t Index>
+        using key_t = std::remove_cvref_t<decltype(tuplex::get<Index>(std::declval<const Row&>()))>;
+
+        // both sides hash their keys as the common type, so keys that compare equal hash equal
+        template <typename Left, typename Right, std::size_t LeftIndex, std::size_t RightIndex>
+        using join_key_t = std::common_type_t<key_t<Left, LeftIndex>, key_t<Right, RightIndex>>;
+
+        template <typename... KeyTypes>
+        struct join_key_list {};
+
+        template <typename Left, typename Right, typename LeftKeys, typename RightKeys>
+        struct join_key_types;
+
+        template <typename Left, typename Right, std::size_t... LeftIndices, std::size_t... RightIndices>
+        struct join_key_types<Left, Right, tuplex::keys<LeftIndices...>, tuplex::keys<RightIndices...>> :
+            type_identity<join_key_list<join_key_t<Left, Right, LeftIndices, RightIndices>...>> {};
+
+        template <std::size_t... LeftIndices, std::size_t... RightIndices>
+        consteval bool same_key_count(tuplex::keys<LeftIndices...>, tuplex::keys<RightIndices...>) noexcept
+        {
+            return sizeof...(LeftIndices) == sizeof...(RightIndices);
+        }
+
+        template <typename Left, typename Right, std::size_t... LeftIndices, std::size_t... RightIndices>
+        consteval bool common_key_types(tuplex::keys<LeftIndices...>, tuplex::keys<RightIndices...>) noexcept
+        {
+            if constexpr (sizeof...(LeftIndices) != sizeof...(RightIndices))
+            {
+                return true; // reported by same_key_count
+            }
+            else
+            {
+                return (requires { typename join_key_t<Left, Right, LeftIndices, RightIndices>; } && ...);
+            }
+        }
+
+        template <typename... KeyTypes, typename Row, std::size_t... Indices>
+        std::uint64_t hash_keys(join_key_list<KeyTypes...>, const Row& row, tuplex::keys<Indices...>)
+        {
+            std::uint64_t h{ 0x9e3779b97f4a7c15ULL };
+            ((h = mix_hash(h ^ static_cast<std::uint64_t>(std::hash<KeyTypes>{}(tuplex::get<Indices>(row))))), ...);
+            return h;
+        }
+
+        template <typename Left, typename Right, std::size_t... LeftIndices, std::size_t... RightIndices>
+        bool keys_equal(const Left& left, const Right& right, tuplex::keys<LeftIndices...>, tuplex::keys<RightIndices...>)
+        {
+            return ((tuplex::get<LeftIndices>(left) == tuplex::get<RightIndices>(right)) && ...);
+        }
+
+        /* ------------------------------------------------------------------------------------------------ */
+        struct join_entry
+        {
+            std::uint64_t hash;
+            std::size_t row;
+        };
+
+        // [begin, end) of the partition's entries sharing hash, begin == end marks an empty slot
+        struct join_bucket
+        {
+            std::uint64_t hash;
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        struct join_partition
+        {
+            std::size_t entries_begin;
+            std::size_t entries_end;
+            std::size_t slots_begin;
+            std::size_t slots_mask;
+        };
+
+        // partitions are sized so that one partition's entries and slots stay within a typical L2
+        inline constexpr std::size_t join_partition_bytes{ 256 * 1024 };
+        inline constexpr std::size_t join_max_radix_bits{ 14 };
+        inline constexpr std::size_t join_chunk_rows{ 16 * 1024 };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <typename LeftRange, typename LeftKeys, typename KeyTypes>
+        class join_table
+        {
+        public:
+            join_table(const LeftRange& left, thread_pool& pool)
+            {
+                const std::size_t rows{ static_cast<std::size_t>(std::ranges::size(left)) };
+                const std::size_t target{ join_partition_bytes / (sizeof(join_entry) + 2 * sizeof(join_bucket)) };
+
+                const std::size_t partitions{ std::clamp<std::size_t>(std::bit_ceil((rows + target - 1) / target), 1,
+                                                                      std::size_t{ 1 } << join_max_radix_bits) };
+                mRadixBits = static_cast<std::size_t>(std::countr_zero(partitions));
+
+                const std::size_t chunks{ (rows + join_chunk_rows - 1) / join_chunk_rows };
+                const std::size_t fanout{ std::size_t{ 1 } << mRadixBits };
+
+                // 1. hash every row and count rows per (chunk, partition)
+                std::vector<std::uint64_t> hashes(rows);
+                std::vector<std::size_t> histograms(chunks * fanout);
+
+                parallel_for_index(chunks, [&](std::size_t chunk)
+                {
+                    auto it{ std::ranges::begin(left) };
+                    const std::size_t end{ std::min(rows, (chunk + 1) * join_chunk_rows) };
+
+                    for (std::size_t row{ chunk * join_chunk_rows }; row < end; ++row)
+                    {
+                        hashes[row] = hash_keys(KeyTypes{}, it[static_cast<std::ranges::range_difference_t<LeftRange>>(row)], LeftKeys{});
+                        ++histograms[chunk * fanout + partition_of(hashes[row])];
+                    }
+                }, pool);
+
+                // 2. prefix sums turn the counts into each chunk's write cursor inside each partition
+                mPartitions.resize(fanout);
+
+                std::size_t entries{};
+                std::size_t slots{};
+
+                for (std::size_t p{}; p < fanout; ++p)
+                {
+                    mPartitions[p].entries_begin = entries;
+
+                    for (std::size_t chunk{}; chunk < chunks; ++chunk)
+                    {
+                        entries += std::exchange(histograms[chunk * fanout + p], entries);
+                    }
+
+                    const std::size_t count{ entries - mPartitions[p].entries_begin };
+                    const std::size_t capacity{ std::bit_ceil(std::max<std::size_t>(2 * count, 2)) };
+
+                    mPartitions[p].entries_end = entries;
+                    mPartitions[p].slots_begin = slots;
+                    mPartitions[p].slots_mask = capacity - 1;
+
+                    slots += capacity;
+                }
+
+                // 3. scatter the rows into their partitions
+                mEntries.resize(rows);
+
+                parallel_for_index(chunks, [&](std::size_t chunk)
+                {
+                    const std::size_t end{ std::min(rows, (chunk + 1) * join_chunk_rows) };
+
+                    for (std::size_t row{ chunk * join_chunk_rows }; row < end; ++row)
+                    {
+                        auto& cursor{ histograms[chunk * fanout + partition_of(hashes[row])] };
+                        mEntries[cursor++] = join_entry{ hashes[row], row };
+                    }
+                }, pool);
+
+                // 4. per partition: group equal hashes and index the groups in an open addressing table
+                mSlots.resize(slots, join_bucket{ 0, 0, 0 });
+
+                parallel_for_index(fanout, [&](std::size_t p)
+                {
+                    const auto& partition{ mPartitions[p] };
+
+                    auto first{ mEntries.begin() + static_cast<std::ptrdiff_t>(partition.entries_begin) };
+                    auto last{ mEntries.begin() + static_cast<std::ptrdiff_t>(partition.entries_end) };
+
+                    std::sort(first, last, [](const join_entry& lhs, const join_entry& rhs)
+                    {
+                        return lhs.hash != rhs.hash ? lhs.hash < rhs.hash : lhs.row < rhs.row;
+                    });
+
+                    for (std::size_t begin{ partition.entries_begin }; begin < partition.entries_end;)
+                    {
+                        std::size_t end{ begin + 1 };
+                        while (end < partition.entries_end && mEntries[end].hash == mEntries[begin].hash)
+                        {
+                            ++end;
+                        }
+
+                        std::size_t slot{ mEntries[begin].hash & partition.slots_mask };
+                        while (mSlots[partition.slots_begin + slot].begin != mSlots[partition.slots_begin + slot].end)
+                        {
+                            slot = (slot + 1) & partition.slots_mask;
+                        }
+                        mSlots[partition.slots_begin + slot] = join_bucket{ mEntries[begin].hash, begin, end };
+
+                        begin = end;
+                    }
+                }, pool);
+            }
+
+            // entries of the left rows whose keys hash to h
+            std::pair<const join_entry*, const join_entry*> find(std::uint64_t h) const noexcept
+            {
+                const auto& partition{ mPartitions[partition_of(h)] };
+
+                for (std::size_t slot{ h & partition.slots_mask };; slot = (slot + 1) & partition.slots_mask)
+                {
+                    const auto& bucket{ mSlots[partition.slots_begin + slot] };
+
+                    if (bucket.begin == bucket.end)
+                    {
+                        return { nullptr, nullptr };
+                    }
+
+                    if (bucket.hash == h)
+                    {
+                        return { mEntries.data() + bucket.begin, mEntries.data() + bucket.end };
+                    }
+                }
+            }
+
+        private:
+            std::size_t partition_of(std::uint64_t h) const noexcept
+            {
+                return mRadixBits == 0 ? 0 : static_cast<std::size_t>(h >> (64 - mRadixBits));
+            }
+
+            std::size_t mRadixBits{};
+            std::vector<join_partition> mPartitions;
+            std::vector<join_entry> mEntries;
+            std::vector<join_bucket> mSlots;
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        // builds the output row in the vector's storage, every field is copied exactly once
+        template <typename Ret, typename Left, typename Right, std::size_t... LeftIndices, std::size_t... RightIndices>
+        void emplace_joined(std::vector<Ret>& out, const Left& left, const Right& right,
+                            std::index_sequence<LeftIndices...>, std::index_sequence<RightIndices...>)
+        {
+            out.emplace_back(tuplex::get<LeftIndices>(left)..., tuplex::get<RightIndices>(right)...);
+        }
+    } // namespace detail
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // inner equi-join of two random access ranges of tuplex::tuple rows on the LeftKeys / RightKeys
+    // elements, returns tuple_cat(left_row, right_row) rows ordered by right row, then left row.
+    // the hash table is built over left, pass the smaller relation there. probing runs on pool.
+    template <typename LeftKeys, typename RightKeys, typename LeftRange, typename RightRange>
+        requires std::ranges::random_access_range<const LeftRange> && std::ranges::sized_range<const LeftRange> &&
+                 std::ranges::random_access_range<const RightRange> && std::ranges::sized_range<const RightRange>
+    auto hash_join(const LeftRange& left, const RightRange& right, thread_pool& pool = default_thread_pool())
+    {
+        using Left = std::ranges::range_value_t<LeftRange>;
+        using Right = std::ranges::range_value_t<RightRange>;
+        using Ret = cat_types_t<Left, Right>;
+
+        static_assert(detail::same_key_count(LeftKeys{}, RightKeys{}),
+                      "hash_join: LeftKeys and RightKeys must name the same number of elements");
+        static_assert(detail::common_key_types<Left, Right>(LeftKeys{}, RightKeys{}),
+                      "hash_join: every LeftKeys / RightKeys element pair must have a std::common_type");
+
+        using key_types = typename detail::join_key_types<Left, Right, LeftKeys, RightKeys>::type;
+
+        using left_indices = std::make_index_sequence<tuplex::tuple_size_v<Left>>;
+        using right_indices = std::make_index_sequence<tuplex::tuple_size_v<Right>>;
+
+        const std::size_t right_rows{ static_cast<std::size_t>(std::ranges::size(right)) };
+
+        if (std::ranges::empty(left) || right_rows == 0)
+        {
+            return std::vector<Ret>{};
+        }
+
+        const detail::join_table<LeftRange, LeftKeys, key_types> table{ left, pool };
+
+        const std::size_t chunks{ (right_rows + detail::join_chunk_rows - 1) / detail::join_chunk_rows };
+        std::vector<std::vector<Ret>> outputs(chunks);
+
+        detail::parallel_for_index(chunks, [&](std::size_t chunk)
+        {
+            const auto left_it{ std::ranges::begin(left) };
+            const auto right_it{ std::ranges::begin(right) };
+            const std::size_t end{ std::min(right_rows, (chunk + 1) * detail::join_chunk_rows) };
+
+            auto& out{ outputs[chunk] };
+
+            for (std::size_t row{ chunk * detail::join_chunk_rows }; row < end; ++row)
+            {
+                const auto& r{ right_it[static_cast<std::ranges::range_difference_t<RightRange>>(row)] };
+                const auto [first, last]{ table.find(detail::hash_keys(key_types{}, r, RightKeys{})) };
+
+                for (const auto* entry{ first }; entry != last; ++entry)
+                {
+                    const auto& l{ left_it[static_cast<std::ranges::range_difference_t<LeftRange>>(entry->row)] };
+
+                    if (detail::keys_equal(l, r, LeftKeys{}, RightKeys{}))
+                    {
+                        detail::emplace_joined(out, l, r, left_indices{}, right_indices{});
+                    }
+                }
+            }
+        }, pool);
+
+        if (chunks == 1)
+        {
+            return std::move(outputs.front());
+        }
+
+        std::size_t total{};
+        for (const auto& out : outputs)
+        {
+            total += out.size();
+        }
+
+        std::vector<Ret> result{};
+        result.reserve(total);
+
+        for (auto& out : outputs)
+        {
+            std::move(out.begin(), out.end(), std::back_inserter(result));
+            out = std::vector<Ret>{};
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,161 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+
+namespace tuplex
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    struct element_layout
+    {
+        std::size_t index;
+        std::size_t offset;
+        std::size_t size;
+        std::size_t alignment;
+        bool crosses_cache_line;
+    };
+
+    namespace detail
+    {
+        /* ------------------------------------------------------------------------------------------------ */
+        constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        // references are stored as pointers
+        template <typename T>
+        using storage_t = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>;
+
+        /* ------------------------------------------------------------------------------------------------ */
+        // replays the compiler's placement of tuple<T, Ts...>: the base tuple<Ts...> sits at offset 0,
+        // mData goes after it. Itanium (gcc, clang) reuses the tail padding of the base, msvc doesn't.
+        template <typename Tp>
+        struct layout_chain;
+
+        template <>
+        struct layout_chain<tuplex::tuple<>>
+        {
+            static constexpr std::size_t end{ 0 };
+        };
+
+        template <typename T, typename... Ts>
+        struct layout_chain<tuplex::tuple<T, Ts...>>
+        {
+            using base = tuplex::tuple<Ts...>;
+            using storage = storage_t<T>;
+
+#if defined(_MSC_VER)
+            static constexpr std::size_t base_end{ std::is_empty_v<base> ? 0 : sizeof(base) };
+#else
+            static constexpr std::size_t base_end{ layout_chain<base>::end };
+#endif
+
+            // the innermost element sits next to the empty tuple<> base, and moves off offset 0 when it
+            // holds a tuple<> subobject there itself. which types do can't be told from outside, but
+            // tuple<T> ends right after the element, so its offset is read from sizeof instead.
+            static constexpr std::size_t offset{ 
+                sizeof...(Ts) == 0 ? sizeof(tuplex::tuple<T>) - sizeof(storage) : align_up(base_end, alignof(storage)) };
+
+            static constexpr std::size_t end{ offset + sizeof(storage) };
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <std::size_t Index, typename Tp>
+        struct drop_front : drop_front<Index - 1, pop_front_t<Tp>> {};
+
+        template <typename Tp>
+        struct drop_front<0, Tp> : type_identity<Tp> {};
+
+        template <std::size_t Index, typename Tp>
+        using drop_front_t = typename drop_front<Index, Tp>::type;
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <std::size_t Index, typename Tp, std::size_t CacheLine>
+        constexpr element_layout make_element_layout() noexcept
+        {
+            using level = layout_chain<drop_front_t<Index, Tp>>;
+
+            return element_layout{ 
+                .index = Index,
+                .offset = level::offset,
+                .size = sizeof(typename level::storage),
+                .alignment = alignof(typename level::storage),
+                .crosses_cache_line = level::offset / CacheLine != (level::end - 1) / CacheLine
+            };
+        }
+
+        template <typename Tp, std::size_t CacheLine, std::size_t... Indices>
+        constexpr std::array<element_layout, sizeof...(Indices)> make_element_layouts(std::index_sequence<Indices...>) noexcept
+        {
+            return { make_element_layout<Indices, Tp, CacheLine>()... };
+        }
+
+        template <std::size_t N>
+        constexpr std::size_t count_crossings(const std::array<element_layout, N>& elements) noexcept
+        {
+            std::size_t crossings{};
+            for (const auto& element : elements)
+            {
+                crossings += element.crosses_cache_line ? 1 : 0;
+            }
+            return crossings;
+        }
+    } // namespace detail
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // offsets, sizes and padding of a tuplex::tuple, cache line crossings assume the tuple starts on
+    // a CacheLine boundary
+    template <typename Tuple, std::size_t CacheLine = 64>
+    struct layout_of;
+
+    template <typename... Ts, std::size_t CacheLine>
+    struct layout_of<tuplex::tuple<Ts...>, CacheLine>
+    {
+        static constexpr std::size_t cache_line{ CacheLine };
+        static constexpr std::size_t size{ sizeof(tuplex::tuple<Ts...>) };
+        static constexpr std::size_t alignment{ alignof(tuplex::tuple<Ts...>) };
+
+        static constexpr std::array<element_layout, sizeof...(Ts)> elements{ 
+            detail::make_element_layouts<tuplex::tuple<Ts...>, CacheLine>(std::index_sequence_for<Ts...>{}) 
+        };
+
+        static constexpr std::size_t padding{ size - (std::size_t{} + ... + sizeof(detail::storage_t<Ts>)) };
+        static constexpr std::size_t cache_line_crossings{ detail::count_crossings(elements) };
+
+        static_assert(sizeof...(Ts) == 0 || detail::align_up(detail::layout_chain<tuplex::tuple<Ts...>>::end, alignment) == size,
+                      "tuplex::layout_of doesn't match this compiler's layout of the tuple");
+    };
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // static_assert(tuplex::max_padding<Record, 8>) or template <tuplex::max_padding<8> Record>
+    template <typename Tuple, std::size_t N>
+    concept max_padding = layout_of<std::remove_cv_t<Tuple>>::padding <= N;
+}
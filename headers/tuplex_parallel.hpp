@@ -0,0 +1,372 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_thread_pool.hpp"
+#include "tuplex_uninitialized.hpp"
+
+namespace tuplex
+{
+    namespace detail
+    {
+        /* ------------------------------------------------------------------------------------------------ */
+        class countdown
+        {
+        public:
+            explicit countdown(std::size_t count) noexcept :
+                mRemaining{ count }
+            { }
+
+            void count_down() noexcept
+            {
+                std::lock_guard lock{ mMutex };
+
+                if (--mRemaining == 0)
+                {
+                    mCv.notify_all();
+                }
+            }
+
+            bool try_wait() noexcept
+            {
+                std::lock_guard lock{ mMutex };
+                return mRemaining == 0;
+            }
+
+            void wait() noexcept
+            {
+                std::unique_lock lock{ mMutex };
+                mCv.wait(lock, [this] { return mRemaining == 0; });
+            }
+
+        private:
+            std::mutex mMutex;
+            std::condition_variable mCv;
+            std::size_t mRemaining;
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        // job 0 runs on the calling thread, which then helps the pool until remaining reaches zero.
+        // every job counts remaining down once, jobs that failed to submit are counted down here.
+        template <typename JobAt>
+        void run_jobs(thread_pool& pool, std::size_t count, JobAt&& job_at, countdown& remaining)
+        {
+            std::size_t submitted{ 1 };
+            std::exception_ptr error{};
+
+            try
+            {
+                for (; submitted < count; ++submitted)
+                {
+                    pool.submit(job_at(submitted));
+                }
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+                for (std::size_t i{ submitted }; i < count; ++i)
+                {
+                    remaining.count_down();
+                }
+            }
+
+            thread_pool::job* first{ job_at(0) };
+            first->run(first);
+
+            while (!remaining.try_wait())
+            {
+                if (!pool.try_run_one())
+                {
+                    remaining.wait();
+                }
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        /* ------------------------------------------------------------------------------------------------ */
+        // fn(0) ... fn(count - 1) on pool, the first exception is rethrown once all calls are done
+        template <typename Fn>
+        class index_jobs
+        {
+        public:
+            index_jobs(std::size_t count, Fn& fn) :
+                mJobs(count), mFunc{ fn }, mRemaining{ count }
+            {
+                for (std::size_t i{}; i < count; ++i)
+                {
+                    mJobs[i] = index_job{ { &index_jobs::run_job }, this, i };
+                }
+            }
+
+            void execute(thread_pool& pool)
+            {
+                run_jobs(pool, mJobs.size(), [this](std::size_t index) { return &mJobs[index]; }, mRemaining);
+
+                if (mError)
+                {
+                    std::rethrow_exception(mError);
+                }
+            }
+
+        private:
+            struct index_job : thread_pool::job
+            {
+                index_jobs* owner;
+                std::size_t index;
+            };
+
+            static void run_job(thread_pool::job* j) noexcept
+            {
+                auto* self{ static_cast<index_job*>(j) };
+                self->owner->run(self->index);
+            }
+
+            void run(std::size_t index) noexcept
+            {
+                try
+                {
+                    mFunc(index);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock{ mErrorMutex };
+                    if (!mError)
+                    {
+                        mError = std::current_exception();
+                    }
+                }
+
+                mRemaining.count_down();
+            }
+
+            std::vector<index_job> mJobs;
+            Fn& mFunc;
+            countdown mRemaining;
+
+            std::mutex mErrorMutex;
+            std::exception_ptr mError{};
+        };
+
+        template <typename Fn>
+        void parallel_for_index(std::size_t count, Fn&& fn, thread_pool& pool)
+        {
+            if (count != 0)
+            {
+                index_jobs<std::remove_reference_t<Fn>> jobs{ count, fn };
+                jobs.execute(pool);
+            }
+        }
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <typename Tp, typename F, std::size_t Index>
+        using element_result_t = std::invoke_result_t<F&, decltype(tuplex::get<Index>(std::declval<Tp>()))>;
+
+        template <std::size_t>
+        using discard_t = void;
+
+        template <std::size_t Index, typename T, typename... Ts>
+        struct nth_type : nth_type<Index - 1, Ts...> {};
+
+        template <typename T, typename... Ts>
+        struct nth_type<0, T, Ts...> : type_identity<T> {};
+
+        /* ------------------------------------------------------------------------------------------------ */
+        // work for element Index, a base of State so one state object holds every job and result
+        template <typename State, std::size_t Index, typename R>
+        class element_job : public thread_pool::job
+        {
+        public:
+            element_job() noexcept :
+                thread_pool::job{ &element_job::run_job }
+            { }
+
+            element_job(const element_job&) = delete;
+            element_job& operator=(const element_job&) = delete;
+
+            ~element_job() noexcept
+            {
+                if constexpr (!std::is_void_v<R>)
+                {
+                    if (mHasValue)
+                    {
+                        mValue.destroy();
+                    }
+                }
+            }
+
+            void run() noexcept
+            {
+                auto& state{ static_cast<State&>(*this) };
+
+                try
+                {
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        static_cast<void>(state.template invoke<Index>());
+                    }
+                    else
+                    {
+                        mValue.construct_with([&]() -> R { return state.template invoke<Index>(); });
+                        mHasValue = true;
+                    }
+                }
+                catch (...)
+                {
+                    mException = std::current_exception();
+                }
+
+                state.mRemaining.count_down();
+            }
+
+            void rethrow_if_exception() const
+            {
+                if (mException)
+                {
+                    std::rethrow_exception(mException);
+                }
+            }
+
+            decltype(auto) result() noexcept
+            {
+                return std::move(mValue).get();
+            }
+
+        private:
+            static void run_job(thread_pool::job* j) noexcept
+            {
+                static_cast<element_job*>(j)->run();
+            }
+
+            struct empty {};
+
+            [[no_unique_address]] std::conditional_t<std::is_void_v<R>, empty, uninitialized<R>> mValue;
+            bool mHasValue{};
+            std::exception_ptr mException{};
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <typename Tp, typename F, typename Indices, typename... Rs>
+        class parallel_state;
+
+        template <typename Tp, typename F, std::size_t... Indices, typename... Rs>
+        class parallel_state<Tp, F, std::index_sequence<Indices...>, Rs...> :
+            public element_job<parallel_state<Tp, F, std::index_sequence<Indices...>, Rs...>, Indices, Rs>...
+        {
+        public:
+            parallel_state(Tp&& tp, F& f) noexcept :
+                mTuple{ std::forward<Tp>(tp) }, mFunc{ f }, mRemaining{ sizeof...(Indices) }
+            { }
+
+            template <std::size_t Index>
+            decltype(auto) invoke()
+            {
+                return std::invoke(mFunc, tuplex::get<Index>(std::forward<Tp>(mTuple)));
+            }
+
+            void execute(thread_pool& pool)
+            {
+                thread_pool::job* jobs[]{ static_cast<job_t<Indices>*>(this)... };
+                run_jobs(pool, sizeof...(Indices), [&jobs](std::size_t index) { return jobs[index]; }, mRemaining);
+
+                (static_cast<job_t<Indices>*>(this)->rethrow_if_exception(), ...);
+            }
+
+            tuplex::tuple<Rs...> results()
+            {
+                return tuplex::tuple<Rs...>{ static_cast<job_t<Indices>*>(this)->result()... };
+            }
+
+        private:
+            template <typename, std::size_t, typename>
+            friend class element_job;
+
+            template <std::size_t Index>
+            using job_t = element_job<parallel_state, Index, typename nth_type<Index, Rs...>::type>;
+
+            Tp&& mTuple;
+            F& mFunc;
+            countdown mRemaining;
+        };
+    } // namespace detail
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // f(get<I>(std::forward<Tp>(tp))) for every element, concurrently on pool, returns when all are done.
+    // f is shared by all the calls and has to be safe to invoke from several threads.
+    template <typename Tp, typename F>
+    void parallel_for_each(Tp&& tp, F&& f, thread_pool& pool = default_thread_pool())
+    {
+        using indices = std::make_index_sequence<tuplex::tuple_size_v<std::remove_cvref_t<Tp>>>;
+
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+        {
+            if constexpr (sizeof...(Indices) != 0)
+            {
+                detail::parallel_state<Tp, F, indices, detail::discard_t<Indices>...> state{ std::forward<Tp>(tp), f };
+                state.execute(pool);
+            }
+        }(indices{});
+    }
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // like parallel_for_each, returns tuplex::tuple<decltype(f(get<I>(std::forward<Tp>(tp))))...>.
+    // every result is built in place and moved once into the returned tuple.
+    template <typename Tp, typename F>
+    auto parallel_transform(Tp&& tp, F&& f, thread_pool& pool = default_thread_pool())
+    {
+        using indices = std::make_index_sequence<tuplex::tuple_size_v<std::remove_cvref_t<Tp>>>;
+
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+        {
+            using Ret = tuplex::tuple<detail::element_result_t<Tp, F, Indices>...>;
+            static_assert((!std::is_void_v<detail::element_result_t<Tp, F, Indices>> && ...), 
+                          "parallel_transform needs non void results, use parallel_for_each");
+
+            if constexpr (sizeof...(Indices) == 0)
+            {
+                return Ret{};
+            }
+            else
+            {
+                detail::parallel_state<Tp, F, indices, detail::element_result_t<Tp, F, Indices>...> state{ std::forward<Tp>(tp), f };
+                state.execute(pool);
+
+                return state.results();
+            }
+        }(indices{});
+    }
+}
@@ -0,0 +1,454 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_thread_pool.hpp"
+#include "tuplex_uninitialized.hpp"
+
+namespace tuplex
+{
+    template <typename T>
+    class task;
+
+    namespace detail
+    {
+        // anything that takes intrusive jobs the way thread_pool does
+        template <typename Pool>
+        concept job_pool = requires(Pool& pool, thread_pool::job* j) { pool.submit(j); };
+
+        template <typename, typename...>
+        class when_all_awaitable;
+
+        /* ------------------------------------------------------------------------------------------------ */
+        struct resume_job : thread_pool::job
+        {
+            std::coroutine_handle<> handle;
+
+            static void resume(thread_pool::job* j) noexcept
+            {
+                static_cast<resume_job*>(j)->handle.resume();
+            }
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        class sync_wait_event
+        {
+        public:
+            void set() noexcept
+            {
+                std::lock_guard lock{ mMutex };
+                mSet = true;
+                mCv.notify_one();
+            }
+
+            void wait() noexcept
+            {
+                std::unique_lock lock{ mMutex };
+                mCv.wait(lock, [this] { return mSet; });
+            }
+
+        private:
+            std::mutex mMutex;
+            std::condition_variable mCv;
+            bool mSet{};
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        class task_promise_base
+        {
+        public:
+            // frames come from the heap, or from the memory resource of a coroutine declared as
+            // task<T> f(std::allocator_arg_t, std::pmr::memory_resource*, ...)
+            static void* operator new(std::size_t size)
+            {
+                return allocate(size, nullptr);
+            }
+
+            template <typename... Args>
+            static void* operator new(std::size_t size, std::allocator_arg_t, std::pmr::memory_resource* resource, Args&...)
+            {
+                return allocate(size, resource);
+            }
+
+            template <typename Self, typename... Args>
+            static void* operator new(std::size_t size, Self&, std::allocator_arg_t, std::pmr::memory_resource* resource, Args&...)
+            {
+                return allocate(size, resource);
+            }
+
+            static void operator delete(void* ptr, std::size_t size) noexcept
+            {
+                auto* raw{ static_cast<std::byte*>(ptr) - header_size };
+                auto* resource{ *std::launder(reinterpret_cast<std::pmr::memory_resource**>(raw)) };
+
+                resource->deallocate(raw, size + header_size, header_size);
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+                {
+                    task_promise_base& promise{ h.promise() };
+
+                    if (promise.mEvent != nullptr)
+                    {
+                        promise.mEvent->set();
+                        return std::noop_coroutine();
+                    }
+
+                    // when_all children: only the last one to finish resumes the awaiter
+                    if (promise.mRemaining != nullptr &&
+                        promise.mRemaining->fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    {
+                        return std::noop_coroutine();
+                    }
+
+                    return promise.mContinuation;
+                }
+
+                void await_resume() const noexcept { }
+            };
+
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                mException = std::current_exception();
+            }
+
+            void rethrow_if_exception() const
+            {
+                if (mException)
+                {
+                    std::rethrow_exception(mException);
+                }
+            }
+
+            // how completion is reported: the awaiter, the when_all counter or the sync_wait event
+            std::coroutine_handle<> mContinuation{ std::noop_coroutine() };
+            std::atomic<std::size_t>* mRemaining{ nullptr };
+            sync_wait_event* mEvent{ nullptr };
+            resume_job mJob{ { &resume_job::resume }, nullptr };
+            std::exception_ptr mException{};
+
+        private:
+            static constexpr std::size_t header_size{ __STDCPP_DEFAULT_NEW_ALIGNMENT__ };
+
+            // heap frames go through new_delete_resource too, so that both ends of every frame are
+            // resource calls and operator delete never frees what an inlined ::operator new returned
+            static void* allocate(std::size_t size, std::pmr::memory_resource* resource)
+            {
+                if (resource == nullptr)
+                {
+                    resource = std::pmr::new_delete_resource();
+                }
+
+                auto* raw{ static_cast<std::byte*>(resource->allocate(size + header_size, header_size)) };
+                ::new (raw) std::pmr::memory_resource*{ resource };
+
+                return raw + header_size;
+            }
+        };
+
+        /* ------------------------------------------------------------------------------------------------ */
+        template <typename T>
+        class task_promise : public task_promise_base
+        {
+        public:
+            task_promise() = default;
+
+            task_promise(const task_promise&) = delete;
+            task_promise& operator=(const task_promise&) = delete;
+
+            ~task_promise() noexcept
+            {
+                if (mHasValue)
+                {
+                    mValue.destroy();
+                }
+            }
+
+            task<T> get_return_object() noexcept
+            {
+                return task<T>{ std::coroutine_handle<task_promise>::from_promise(*this) };
+            }
+
+            template <typename U>
+                requires std::is_convertible_v<U&&, T>
+            void return_value(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+            {
+                mValue.construct(std::forward<U>(value));
+                mHasValue = true;
+            }
+
+            // T&& for values so that the caller decides where the one move goes
+            decltype(auto) result()
+            {
+                rethrow_if_exception();
+                return std::move(mValue).get();
+            }
+
+        private:
+            uninitialized<T> mValue;
+            bool mHasValue{};
+        };
+
+        template <>
+        class task_promise<void> : public task_promise_base
+        {
+        public:
+            task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept { }
+
+            void result() const
+            {
+                rethrow_if_exception();
+            }
+        };
+    } // namespace detail
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // lazy coroutine, starts when awaited, by when_all or by sync_wait
+    template <typename T = void>
+    class [[nodiscard]] task
+    {
+    public:
+        using promise_type = detail::task_promise<T>;
+
+        task(task&& rhs) noexcept :
+            mHandle{ std::exchange(rhs.mHandle, nullptr) }
+        { }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (mHandle)
+                {
+                    mHandle.destroy();
+                }
+                mHandle = std::exchange(rhs.mHandle, nullptr);
+            }
+            return *this;
+        }
+
+        ~task() noexcept
+        {
+            if (mHandle)
+            {
+                mHandle.destroy();
+            }
+        }
+
+        auto operator co_await() const noexcept
+        {
+            struct awaiter
+            {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+                {
+                    handle.promise().mContinuation = continuation;
+                    return handle;
+                }
+
+                T await_resume()
+                {
+                    return handle.promise().result();
+                }
+            };
+
+            return awaiter{ mHandle };
+        }
+
+    private:
+        friend promise_type;
+
+        template <typename, typename...>
+        friend class detail::when_all_awaitable;
+
+        template <typename U>
+        friend U sync_wait(task<U> t);
+
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept :
+            mHandle{ handle }
+        { }
+
+        std::coroutine_handle<promise_type> mHandle;
+    };
+
+    inline task<void> detail::task_promise<void>::get_return_object() noexcept
+    {
+        return task<void>{ std::coroutine_handle<task_promise>::from_promise(*this) };
+    }
+
+    /* ------------------------------------------------------------------------------------------------ */
+    namespace detail
+    {
+        template <typename Pool, typename... Ts>
+        class when_all_awaitable
+        {
+        public:
+            explicit when_all_awaitable(Pool& pool, task<Ts>&&... tasks) :
+                mPool{ pool }, mTasks{ std::move(tasks)... }
+            { }
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            // one extra count for the awaiter itself so a child that finishes before
+            // scheduling is over can't resume it early
+            bool await_suspend(std::coroutine_handle<> awaiter)
+            {
+                mRemaining.store(sizeof...(Ts) + 1, std::memory_order_relaxed);
+                start(awaiter, std::index_sequence_for<Ts...>{});
+
+                return mRemaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            tuplex::tuple<Ts...> await_resume()
+            {
+                if (mSubmitError)
+                {
+                    std::rethrow_exception(mSubmitError);
+                }
+
+                return collect(std::index_sequence_for<Ts...>{});
+            }
+
+        private:
+            template <std::size_t... Indices>
+            void start(std::coroutine_handle<> awaiter, std::index_sequence<Indices...>)
+            {
+                (start_one(tuplex::get<Indices>(mTasks), awaiter), ...);
+            }
+
+            // once a submit fails the remaining children are never started and don't count, the
+            // awaiter is still resumed by the last child that runs and rethrows the submit error
+            template <typename T>
+            void start_one(task<T>& t, std::coroutine_handle<> awaiter)
+            {
+                if (!mSubmitError)
+                {
+                    auto& promise{ t.mHandle.promise() };
+
+                    promise.mContinuation = awaiter;
+                    promise.mRemaining = &mRemaining;
+                    promise.mJob.handle = t.mHandle;
+
+                    try
+                    {
+                        mPool.submit(&promise.mJob);
+                        return;
+                    }
+                    catch (...)
+                    {
+                        mSubmitError = std::current_exception();
+                    }
+                }
+
+                mRemaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            template <std::size_t... Indices>
+            tuplex::tuple<Ts...> collect(std::index_sequence<Indices...>)
+            {
+                return tuplex::tuple<Ts...>{ tuplex::get<Indices>(mTasks).mHandle.promise().result()... };
+            }
+
+            Pool& mPool;
+            tuplex::tuple<task<Ts>...> mTasks;
+            std::atomic<std::size_t> mRemaining{};
+            std::exception_ptr mSubmitError{};
+        };
+    } // namespace detail
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // runs the tasks concurrently on pool (a thread_pool or anything with its submit), the awaiter
+    // is resumed by the last one to finish. results are moved once from the child frames into the
+    // returned tuple.
+    template <detail::job_pool Pool, typename... Ts>
+        requires (sizeof...(Ts) > 0 && (!std::is_void_v<Ts> && ...))
+    [[nodiscard]] auto when_all(Pool& pool, task<Ts>... tasks)
+    {
+        return detail::when_all_awaitable<Pool, Ts...>{ pool, std::move(tasks)... };
+    }
+
+    template <typename... Ts>
+        requires (sizeof...(Ts) > 0 && (!std::is_void_v<Ts> && ...))
+    [[nodiscard]] auto when_all(task<Ts>... tasks)
+    {
+        return detail::when_all_awaitable<thread_pool, Ts...>{ default_thread_pool(), std::move(tasks)... };
+    }
+
+    /* ------------------------------------------------------------------------------------------------ */
+    // starts t on the calling thread and blocks until it's done
+    template <typename T>
+    T sync_wait(task<T> t)
+    {
+        detail::sync_wait_event event{};
+
+        auto& promise{ t.mHandle.promise() };
+        promise.mEvent = &event;
+
+        t.mHandle.resume();
+        event.wait();
+
+        return promise.result();
+    }
+}
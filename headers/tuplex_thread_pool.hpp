@@ -0,0 +1,204 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tuplex
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    // work-stealing pool: every worker owns a deque, pushes and pops its back, idle workers steal
+    // from the front of the others. jobs are intrusive, submit never allocates a job object.
+    class thread_pool
+    {
+    public:
+        struct job
+        {
+            void (*run)(job*) noexcept;
+        };
+
+        explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency()) :
+            mQueues(std::max<std::size_t>(threads, 1))
+        {
+            mWorkers.reserve(mQueues.size());
+            for (std::size_t i{}; i < mQueues.size(); ++i)
+            {
+                mWorkers.emplace_back([this, i] { worker_loop(i); });
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() noexcept
+        {
+            {
+                std::lock_guard lock{ mSleepMutex };
+                mStop = true;
+            }
+            mSleepCv.notify_all();
+
+            mWorkers.clear();
+        }
+
+        // the job must stay alive until its run() is called
+        void submit(job* j)
+        {
+            const auto& current{ current_worker() };
+            const std::size_t index{ current.pool == this ? current.index 
+                                                          : mNext.fetch_add(1, std::memory_order_relaxed) % mQueues.size() };
+
+            {
+                std::lock_guard lock{ mQueues[index].mutex };
+                mQueues[index].jobs.push_back(j);
+            }
+            mPending.fetch_add(1, std::memory_order_release);
+
+            {
+                std::lock_guard lock{ mSleepMutex };
+            }
+            mSleepCv.notify_one();
+        }
+
+        // runs one pending job on the calling thread, lets a blocked caller help instead of idling
+        bool try_run_one()
+        {
+            const auto& current{ current_worker() };
+            job* j{ take(current.pool == this ? current.index : 0) };
+
+            if (j == nullptr)
+            {
+                return false;
+            }
+
+            j->run(j);
+            return true;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return mQueues.size();
+        }
+
+    private:
+        struct queue
+        {
+            std::mutex mutex;
+            std::deque<job*> jobs;
+        };
+
+        struct worker_slot
+        {
+            thread_pool* pool;
+            std::size_t index;
+        };
+
+        static worker_slot& current_worker() noexcept
+        {
+            thread_local worker_slot slot{ nullptr, 0 };
+            return slot;
+        }
+
+        job* take(std::size_t index)
+        {
+            job* j{ nullptr };
+
+            {
+                auto& own{ mQueues[index] };
+                std::lock_guard lock{ own.mutex };
+
+                if (!own.jobs.empty())
+                {
+                    j = own.jobs.back();
+                    own.jobs.pop_back();
+                }
+            }
+
+            for (std::size_t i{ 1 }; j == nullptr && i < mQueues.size(); ++i)
+            {
+                auto& victim{ mQueues[(index + i) % mQueues.size()] };
+                std::lock_guard lock{ victim.mutex };
+
+                if (!victim.jobs.empty())
+                {
+                    j = victim.jobs.front();
+                    victim.jobs.pop_front();
+                }
+            }
+
+            if (j != nullptr)
+            {
+                mPending.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            return j;
+        }
+
+        void worker_loop(std::size_t index)
+        {
+            current_worker() = worker_slot{ this, index };
+
+            while (true)
+            {
+                if (job* j{ take(index) }; j != nullptr)
+                {
+                    j->run(j);
+                    continue;
+                }
+
+                std::unique_lock lock{ mSleepMutex };
+                mSleepCv.wait(lock, [this] { return mStop || mPending.load(std::memory_order_acquire) != 0; });
+
+                if (mStop && mPending.load(std::memory_order_acquire) == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        std::vector<queue> mQueues;
+        std::atomic<std::size_t> mPending{};
+        std::atomic<std::size_t> mNext{};
+
+        std::mutex mSleepMutex;
+        std::condition_variable mSleepCv;
+        bool mStop{};
+
+        std::vector<std::jthread> mWorkers;
+    };
+
+    /* ------------------------------------------------------------------------------------------------ */
+    inline thread_pool& default_thread_pool()
+    {
+        static thread_pool pool{};
+        return pool;
+    }
+}
@@ -0,0 +1,126 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace tuplex::detail
+{
+    /* ------------------------------------------------------------------------------------------------ */
+    // storage for one value constructed later, the owner tracks whether it's alive
+    template <typename T>
+    class uninitialized
+    {
+    public:
+        constexpr uninitialized() noexcept { }
+        constexpr ~uninitialized() noexcept { }
+
+        template <typename... Args>
+        constexpr T& construct(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+        {
+            return *std::construct_at(std::addressof(mData), std::forward<Args>(args)...);
+        }
+
+        // fn's prvalue result initializes the value directly, no temporary to move from
+        template <typename Fn>
+        constexpr T& construct_with(Fn&& fn)
+        {
+            return *::new (static_cast<void*>(std::addressof(mData))) T(std::forward<Fn>(fn)());
+        }
+
+        constexpr void destroy() noexcept
+        {
+            std::destroy_at(std::addressof(mData));
+        }
+
+        constexpr T& get() & noexcept
+        {
+            return mData;
+        }
+
+        constexpr T&& get() && noexcept
+        {
+            return std::move(mData);
+        }
+
+    private:
+        union { T mData; };
+    };
+
+    template <typename T>
+    class uninitialized<T&>
+    {
+    public:
+        constexpr T& construct(T& value) noexcept
+        {
+            mData = std::addressof(value);
+            return value;
+        }
+
+        template <typename Fn>
+        constexpr T& construct_with(Fn&& fn)
+        {
+            return construct(std::forward<Fn>(fn)());
+        }
+
+        constexpr void destroy() noexcept { }
+
+        constexpr T& get() const noexcept
+        {
+            return *mData;
+        }
+
+    private:
+        T* mData;
+    };
+
+    template <typename T>
+    class uninitialized<T&&>
+    {
+    public:
+        constexpr T&& construct(T&& value) noexcept
+        {
+            mData = std::addressof(value);
+            return std::move(value);
+        }
+
+        template <typename Fn>
+        constexpr T&& construct_with(Fn&& fn)
+        {
+            return construct(std::forward<Fn>(fn)());
+        }
+
+        constexpr void destroy() noexcept { }
+
+        constexpr T&& get() const noexcept
+        {
+            return std::move(*mData);
+        }
+
+    private:
+        T* mData;
+    };
+} // namespace tuplex::detail
@@ -28,6 +28,7 @@
 #include <utility>
 
 #include "tuplex.hpp"
+#include "tuplex_instrument.hpp"
 
 namespace tuplex
 {
@@ -127,11 +128,13 @@ namespace tuplex
 
     /* ------------------------------------------------------------------------------------------------ */
     template <std::size_t Index, typename Tp>
-    constexpr decltype(auto) get(Tp&& t) noexcept
+    constexpr decltype(auto) get(Tp&& t TUPLEX_INSTRUMENT_LOCATION) noexcept
     {
         using T = std::remove_cvref_t<Tp>;
         static_assert(tuple_size_v<T> > Index, "tuple out of range");
 
+        TUPLEX_INSTRUMENT_CALL(get, tuplex_location, instrument::counts{});
+
         return detail::get_impl<Index, T>{}(std::forward<Tp>(t));
     }
 
@@ -139,6 +142,8 @@ namespace tuplex
     template <typename... Args>
     constexpr tuplex::tuple<Args&&...> forward_as_tuple(Args&&... args) noexcept
     {
+        TUPLEX_INSTRUMENT_CALL(forward_as_tuple, std::source_location::current(), instrument::counts{});
+
         return tuplex::tuple<Args&&...>{ std::forward<Args>(args)... };
     }
 
@@ -146,6 +151,9 @@ namespace tuplex
     template <typename... Args>
     constexpr tuplex::tuple<std::unwrap_ref_decay_t<Args>...> make_tuple(Args&&... args)
     {
+        TUPLEX_INSTRUMENT_CALL(make_tuple, std::source_location::current(),
+                               (instrument::counts{} + ... + detail::init_counts<std::unwrap_ref_decay_t<Args>, Args&&>()));
+
         return tuplex::tuple<std::unwrap_ref_decay_t<Args>...>{ std::forward<Args>(args)... };
     }
 
@@ -218,6 +226,17 @@ namespace tuplex
             }
         };
 
+#ifdef TUPLEX_INSTRUMENT
+        template <typename Tp, std::size_t... Indices>
+        constexpr instrument::counts tuple_cat_counts(std::index_sequence<Indices...>) noexcept
+        {
+            using T = std::remove_cvref_t<Tp>;
+
+            return (instrument::counts{} + ... + 
+                    init_counts<typename get_impl<Indices, T>::data_t, decltype(tuplex::get<Indices>(std::declval<Tp>()))>());
+        }
+#endif
+
         template <typename Ret, typename Tp, std::size_t... Indices>
         constexpr Ret tuple_cat_ret_wrapper(Tp&& tp, std::index_sequence<Indices...>) noexcept
         {
@@ -240,6 +259,10 @@ namespace tuplex
                                                    std::index_sequence<>,
                                                    current_indices>;
 
+        TUPLEX_INSTRUMENT_CALL(tuple_cat, std::source_location::current(),
+                               (detail::tuple_cat_counts<FirstTuple&&>(current_indices{}) + ... + 
+                                detail::tuple_cat_counts<Other&&>(std::make_index_sequence<tuplex::tuple_size_v<std::remove_cvref_t<Other>>>{})));
+
         return detail::tuple_cat_ret_wrapper<Ret>(
             CatExecutor{}(
                 tuplex::tuple<>{},
@@ -0,0 +1,107 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <ranges>
+#include <source_location>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../headers/tuplex.hpp"
+#include "../headers/tuplex_utils.hpp"
+#include "../headers/tuplex_thread_pool.hpp"
+#include "../headers/tuplex_uninitialized.hpp"
+#include "../headers/tuplex_task.hpp"
+#include "../headers/tuplex_parallel.hpp"
+#include "../headers/tuplex_layout.hpp"
+#include "../headers/tuplex_join.hpp"
+
+export module tuplex;
+
+export namespace tuplex
+{
+    using tuplex::tuple;
+
+    using tuplex::tuple_size;
+    using tuplex::tuple_size_v;
+
+    using tuplex::get;
+    using tuplex::forward_as_tuple;
+    using tuplex::make_tuple;
+
+    using tuplex::cat_types;
+    using tuplex::cat_types_t;
+    using tuplex::tuple_cat;
+
+    using tuplex::thread_pool;
+    using tuplex::default_thread_pool;
+
+    using tuplex::task;
+    using tuplex::when_all;
+    using tuplex::sync_wait;
+
+    using tuplex::parallel_for_each;
+    using tuplex::parallel_transform;
+
+    using tuplex::element_layout;
+    using tuplex::layout_of;
+    using tuplex::max_padding;
+
+    using tuplex::keys;
+    using tuplex::hash_join;
+}
+
+#ifdef TUPLEX_INSTRUMENT
+export namespace tuplex::instrument
+{
+    using tuplex::instrument::operation;
+    using tuplex::instrument::to_string;
+    using tuplex::instrument::counts;
+    using tuplex::instrument::site;
+    using tuplex::instrument::registry;
+    using tuplex::instrument::scope;
+}
+#endif
@@ -0,0 +1,248 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <source_location>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../headers/tuplex.hpp"
+#include "../../headers/tuplex_utils.hpp"
+
+#include "../utils/test_utils.hpp"
+
+#ifndef TUPLEX_INSTRUMENT
+#error "tests_instrument has to be built with TUPLEX_INSTRUMENT"
+#endif
+
+// recorded copies / moves are predictions from the argument categories, every test checks them
+// against the counts each category must give and against the copies and moves a counter element
+// really went through, in every cv-ref category
+
+namespace
+{
+    using tuplex::instrument::counts;
+    using tuplex::instrument::operation;
+    using tuplex::instrument::registry;
+
+    using test_utils::CV_REF;
+
+    counts recorded(operation op)
+    {
+        return registry::instance().total(op);
+    }
+
+    // copy / move counter that can also be initialized from volatile values
+    struct cv_counter
+    {
+        cv_counter() = default;
+
+        cv_counter(const cv_counter& rhs) :
+            copies{ rhs.copies + 1 }, moves{ rhs.moves }
+        { }
+
+        cv_counter(const volatile cv_counter& rhs) :
+            copies{ rhs.copies + 1 }, moves{ rhs.moves }
+        { }
+
+        cv_counter(cv_counter&& rhs) noexcept :
+            copies{ rhs.copies }, moves{ rhs.moves + 1 }
+        { }
+
+        cv_counter(volatile cv_counter&& rhs) noexcept :
+            copies{ rhs.copies }, moves{ rhs.moves + 1 }
+        { }
+
+        // a const rvalue can't be moved from
+        cv_counter(const volatile cv_counter&& rhs) :
+            copies{ rhs.copies + 1 }, moves{ rhs.moves }
+        { }
+
+        std::size_t copies{};
+        std::size_t moves{};
+    };
+
+    // what one call initializing n elements has to do: non-const rvalues are moved, the rest is copied
+    template <CV_REF type>
+    counts expected(std::size_t n)
+    {
+        const bool moved{ type == CV_REF::PLAIN_REF_REF || type == CV_REF::VOLATILE_REF_REF };
+
+        return counts{
+            .calls = 1,
+            .constructions = n,
+            .copies = moved ? 0 : n,
+            .moves = moved ? n : 0
+        };
+    }
+
+    // what one call initializing every counter of tp really did, minus the moves the sources already carried
+    template <typename Tp, std::size_t... Indices>
+    counts observed(const Tp& tp, std::size_t source_moves, std::index_sequence<Indices...>)
+    {
+        return counts{ 
+            .calls = 1,
+            .constructions = sizeof...(Indices),
+            .copies = (std::size_t{} + ... + tuplex::get<Indices>(tp).copies),
+            .moves = (std::size_t{} + ... + tuplex::get<Indices>(tp).moves) - source_moves * sizeof...(Indices)
+        };
+    }
+}
+
+class tuplex_instrument : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        registry::instance().reset();
+    }
+};
+
+TEST_F(tuplex_instrument, get)
+{
+    using namespace test_utils;
+
+    for_cv_ref([]<CV_REF type>() -> void
+    {
+        registry::instance().reset();
+
+        tuplex::tuple<int, cm_counter> tp{ 1, cm_counter{} };
+        [[maybe_unused]] auto&& value{ tuplex::get<0>(as_t<type>(tp)) };
+        [[maybe_unused]] auto&& counter{ tuplex::get<1>(as_t<type>(tp)) };
+
+        ASSERT_EQ(recorded(operation::get), (counts{ .calls = 2 }));
+    });
+}
+
+TEST_F(tuplex_instrument, forward_as_tuple)
+{
+    using namespace test_utils;
+
+    for_cv_ref([]<CV_REF type>() -> void
+    {
+        registry::instance().reset();
+
+        int a{};
+        float b{};
+        [[maybe_unused]] auto tp{ tuplex::forward_as_tuple(as_t<type>(a), as_t<type>(b)) };
+
+        ASSERT_EQ(recorded(operation::forward_as_tuple), (counts{ .calls = 1 }));
+    });
+}
+
+TEST_F(tuplex_instrument, make_tuple)
+{
+    using namespace test_utils;
+
+    for_cv_ref([]<CV_REF type>() -> void
+    {
+        registry::instance().reset();
+
+        cv_counter a{};
+        cv_counter b{};
+        cv_counter c{};
+        auto tp{ tuplex::make_tuple(as_t<type>(a), as_t<type>(b), as_t<type>(c)) };
+
+        ASSERT_EQ(recorded(operation::make_tuple), expected<type>(3));
+        ASSERT_EQ(recorded(operation::make_tuple), observed(tp, 0, std::make_index_sequence<3>{}));
+    });
+}
+
+TEST_F(tuplex_instrument, tuple_cat)
+{
+    using namespace test_utils;
+
+    for_cv_ref([]<CV_REF type>() -> void
+    {
+        tuplex::tuple<cv_counter, cv_counter> t1{ cv_counter{}, cv_counter{} };
+        tuplex::tuple<cv_counter, cv_counter, cv_counter> t2{ cv_counter{}, cv_counter{}, cv_counter{} };
+
+        registry::instance().reset();
+
+        auto res{ tuplex::tuple_cat(as_t<type>(t1), as_t<type>(t2)) };
+
+        // tuple_cat's own get / forward_as_tuple calls are not reported
+        ASSERT_EQ(recorded(operation::get), counts{});
+        ASSERT_EQ(recorded(operation::forward_as_tuple), counts{});
+
+        ASSERT_EQ(recorded(operation::tuple_cat), expected<type>(5));
+
+        // every source counter was moved in once
+        ASSERT_EQ(recorded(operation::tuple_cat), observed(res, 1, std::make_index_sequence<5>{}));
+    });
+}
+
+TEST_F(tuplex_instrument, call_sites)
+{
+    tuplex::tuple<int> tp{ 1 };
+
+    const auto first{ std::source_location::current().line() + 1 };
+    [[maybe_unused]] auto& a{ tuplex::get<0>(tp) };
+    [[maybe_unused]] auto& b{ tuplex::get<0>(tp) };
+
+    std::uint_least32_t scope_line{};
+    {
+        const tuplex::instrument::scope scope{};
+        scope_line = scope.location().line();
+
+        [[maybe_unused]] auto made_tp{ tuplex::make_tuple(1, 2) };
+    }
+
+    [[maybe_unused]] auto unscoped_tp{ tuplex::make_tuple(1.0) };
+
+    std::vector<std::uint_least32_t> get_lines{};
+    std::uint_least32_t make_tuple_line{};
+    std::size_t unscoped{};
+
+    registry::instance().for_each([&](const tuplex::instrument::site& s, const counts& c)
+    {
+        if (s.op == operation::get)
+        {
+            ASSERT_EQ(c.calls, 1);
+            get_lines.push_back(s.line);
+        }
+        else if (s.op == operation::make_tuple && s.file.empty())
+        {
+            // no scope, the header line of make_tuple must not show up as a call site
+            ASSERT_EQ(s.line, 0u);
+            ++unscoped;
+        }
+        else if (s.op == operation::make_tuple)
+        {
+            make_tuple_line = s.line;
+        }
+    });
+
+    ASSERT_EQ(get_lines, (std::vector<std::uint_least32_t>{ first, first + 1 }));
+    ASSERT_EQ(make_tuple_line, scope_line);
+    ASSERT_EQ(unscoped, 1u);
+
+    std::ostringstream report{};
+    registry::instance().report(report);
+
+    ASSERT_NE(report.str().find("(no scope) make_tuple"), std::string::npos);
+    ASSERT_EQ(report.str().find("tuplex_utils.hpp"), std::string::npos);
+}
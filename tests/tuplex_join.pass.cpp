@@ -0,0 +1,243 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../headers/tuplex.hpp"
+#include "../headers/tuplex_utils.hpp"
+#include "../headers/tuplex_join.hpp"
+
+#include "utils/test_utils.hpp"
+
+namespace
+{
+    template <typename LeftKeys, typename RightKeys, typename Left, typename Right>
+    auto nested_loop_join(const std::vector<Left>& left, const std::vector<Right>& right)
+    {
+        std::vector<tuplex::cat_types_t<Left, Right>> result{};
+
+        for (const auto& r : right)
+        {
+            for (const auto& l : left)
+            {
+                if (tuplex::detail::keys_equal(l, r, LeftKeys{}, RightKeys{}))
+                {
+                    result.push_back(tuplex::tuple_cat(l, r));
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // tuplex::tuple has no comparison operators, compare the rows as std::tuple
+    template <typename... Ts>
+    std::tuple<Ts...> as_std(const tuplex::tuple<Ts...>& row)
+    {
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+        {
+            return std::tuple<Ts...>{ tuplex::get<Indices>(row)... };
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename... Ts>
+    std::vector<std::tuple<Ts...>> as_std(const std::vector<tuplex::tuple<Ts...>>& rows)
+    {
+        std::vector<std::tuple<Ts...>> result{};
+        for (const auto& row : rows)
+        {
+            result.push_back(as_std(row));
+        }
+        return result;
+    }
+}
+
+TEST(tuplex_join, single_key)
+{
+    tuplex::thread_pool pool{ 4 };
+
+    std::vector<tuplex::tuple<int, std::string>> left{};
+    left.emplace_back(1, "one");
+    left.emplace_back(2, "two");
+    left.emplace_back(3, "three");
+
+    std::vector<tuplex::tuple<double, int>> right{};
+    right.emplace_back(0.5, 3);
+    right.emplace_back(1.5, 4);
+    right.emplace_back(2.5, 1);
+    right.emplace_back(3.5, 3);
+
+    auto result{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<1>>(left, right, pool) };
+
+    static_assert(std::is_same_v<decltype(result), std::vector<tuplex::tuple<int, std::string, double, int>>>);
+
+    ASSERT_EQ(result.size(), 3u);
+    ASSERT_EQ(as_std(result[0]), (std::tuple<int, std::string, double, int>{ 3, "three", 0.5, 3 }));
+    ASSERT_EQ(as_std(result[1]), (std::tuple<int, std::string, double, int>{ 1, "one", 2.5, 1 }));
+    ASSERT_EQ(as_std(result[2]), (std::tuple<int, std::string, double, int>{ 3, "three", 3.5, 3 }));
+}
+
+TEST(tuplex_join, duplicates_and_ordering)
+{
+    tuplex::thread_pool pool{ 4 };
+
+    std::vector<tuplex::tuple<int, int>> left{};
+    std::vector<tuplex::tuple<int, int>> right{};
+
+    for (int i{}; i < 500; ++i)
+    {
+        left.emplace_back(i % 7, i);
+        right.emplace_back(i % 11, -i);
+    }
+
+    auto result{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(left, right, pool) };
+
+    ASSERT_EQ(as_std(result), as_std(nested_loop_join<tuplex::keys<0>, tuplex::keys<0>>(left, right)));
+}
+
+TEST(tuplex_join, multiple_keys)
+{
+    tuplex::thread_pool pool{ 2 };
+
+    std::vector<tuplex::tuple<std::string, int, char>> left{};
+    std::vector<tuplex::tuple<int, std::string, long>> right{};
+
+    for (int i{}; i < 300; ++i)
+    {
+        left.emplace_back("k" + std::to_string(i % 13), i % 5, static_cast<char>('a' + i % 26));
+        right.emplace_back(i % 3, "k" + std::to_string(i % 17), i);
+    }
+
+    auto result{ tuplex::hash_join<tuplex::keys<0, 1>, tuplex::keys<1, 0>>(left, right, pool) };
+    auto expected{ nested_loop_join<tuplex::keys<0, 1>, tuplex::keys<1, 0>>(left, right) };
+
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(as_std(result), as_std(expected));
+}
+
+TEST(tuplex_join, mixed_key_types)
+{
+    tuplex::thread_pool pool{ 2 };
+
+    std::vector<tuplex::tuple<int>> ints{};
+    ints.emplace_back(1);
+    ints.emplace_back(2);
+
+    std::vector<tuplex::tuple<double>> doubles{};
+    doubles.emplace_back(1.0);
+    doubles.emplace_back(2.0);
+    doubles.emplace_back(2.5);
+
+    auto numbers{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(ints, doubles, pool) };
+    ASSERT_EQ(as_std(numbers), as_std(nested_loop_join<tuplex::keys<0>, tuplex::keys<0>>(ints, doubles)));
+    ASSERT_EQ(numbers.size(), 2u);
+
+    std::vector<tuplex::tuple<std::string, int>> strings{};
+    strings.emplace_back("ann", 1);
+    strings.emplace_back("bob", 2);
+
+    std::vector<tuplex::tuple<const char*>> literals{};
+    literals.emplace_back("bob");
+
+    auto names{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(strings, literals, pool) };
+    ASSERT_EQ(names.size(), 1u);
+    ASSERT_EQ(tuplex::get<1>(names[0]), 2);
+}
+
+TEST(tuplex_join, empty_inputs)
+{
+    tuplex::thread_pool pool{ 2 };
+
+    std::vector<tuplex::tuple<int>> empty{};
+    std::vector<tuplex::tuple<int>> rows{ tuplex::tuple<int>{ 1 }, tuplex::tuple<int>{ 2 } };
+    std::vector<tuplex::tuple<int>> other{ tuplex::tuple<int>{ 3 } };
+
+    ASSERT_TRUE((tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(empty, rows, pool).empty()));
+    ASSERT_TRUE((tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(rows, empty, pool).empty()));
+    ASSERT_TRUE((tuplex::hash_join<tuplex::keys<0>, tuplex::keys<0>>(rows, other, pool).empty()));
+}
+
+TEST(tuplex_join, many_partitions)
+{
+    tuplex::thread_pool pool{ 4 };
+
+    std::vector<tuplex::tuple<std::uint64_t, std::uint32_t>> left{};
+    std::vector<tuplex::tuple<std::uint32_t, std::uint64_t>> right{};
+
+    for (std::uint32_t i{}; i < 200'000; ++i)
+    {
+        left.emplace_back(i * 3ull, i);
+    }
+
+    for (std::uint32_t i{}; i < 100'000; ++i)
+    {
+        right.emplace_back(i, (i * 7919ull) % 700'000);
+    }
+
+    auto result{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<1>>(left, right, pool) };
+
+    std::size_t expected{};
+    for (std::uint32_t i{}; i < 100'000; ++i)
+    {
+        const std::uint64_t key{ (i * 7919ull) % 700'000 };
+        if (key % 3 == 0 && key / 3 < 200'000)
+        {
+            ASSERT_EQ(as_std(result[expected]), (std::tuple<std::uint64_t, std::uint32_t, std::uint32_t, std::uint64_t>{
+                key, static_cast<std::uint32_t>(key / 3), i, key }));
+            ++expected;
+        }
+    }
+
+    ASSERT_EQ(result.size(), expected);
+}
+
+TEST(tuplex_join, copies_fields_once)
+{
+    using namespace test_utils;
+
+    tuplex::thread_pool pool{ 2 };
+
+    std::vector<tuplex::tuple<int, cm_counter>> left{};
+    left.emplace_back(1, cm_counter{});
+
+    std::vector<tuplex::tuple<cm_counter, int>> right{};
+    right.emplace_back(cm_counter{}, 1);
+
+    auto result{ tuplex::hash_join<tuplex::keys<0>, tuplex::keys<1>>(left, right, pool) };
+
+    // one copy on top of whatever the source rows already carry
+    const cm_counter left_once{ tuplex::get<1>(left[0]) };
+    const cm_counter right_once{ tuplex::get<0>(right[0]) };
+
+    ASSERT_EQ(result.size(), 1u);
+    ASSERT_EQ(tuplex::get<1>(result[0]), left_once);
+    ASSERT_EQ(tuplex::get<2>(result[0]), right_once);
+}
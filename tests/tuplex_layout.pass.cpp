@@ -0,0 +1,143 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "../headers/tuplex.hpp"
+#include "../headers/tuplex_utils.hpp"
+#include "../headers/tuplex_layout.hpp"
+
+namespace
+{
+    struct empty {};
+
+    struct alignas(32) overaligned
+    {
+        char c;
+    };
+
+    // a tuplex::tuple subobject at offset 0 without being a tuplex::tuple
+    struct holds_tuple
+    {
+        tuplex::tuple<int> t;
+        int x;
+    };
+
+    template <typename Tuple, std::size_t... Indices>
+    bool offsets_match(Tuple& tp, std::index_sequence<Indices...>)
+    {
+        using layout = tuplex::layout_of<Tuple>;
+
+        const auto* base{ reinterpret_cast<const volatile std::byte*>(&tp) };
+
+        return ((layout::elements[Indices].offset ==
+                 static_cast<std::size_t>(reinterpret_cast<const volatile std::byte*>(&tuplex::get<Indices>(tp)) - base)) && ...);
+    }
+}
+
+TEST(tuplex_layout, offsets_match_real_layout)
+{
+    int value{};
+
+    tuplex::tuple<char, int, char> t1{ 'a', 1, 'b' };
+    tuplex::tuple<char, char, int> t2{ 'a', 'b', 1 };
+    tuplex::tuple<empty, int, empty> t3{ empty{}, 1, empty{} };
+    tuplex::tuple<char, overaligned, short> t4{ 'a', overaligned{}, short{ 1 } };
+    tuplex::tuple<std::string, double, char, std::array<char, 70>> t5{ "tuplex", 1.0, 'c', std::array<char, 70>{} };
+    tuplex::tuple<tuplex::tuple<>> t6{ tuplex::tuple<>{} };
+    tuplex::tuple<char, long long, int&> t7{ 'a', 1LL, value };
+    tuplex::tuple<tuplex::tuple<int>> t8{ tuplex::tuple<int>{ 1 } };
+    tuplex::tuple<double, tuplex::tuple<int>> t9{ 1.0, tuplex::tuple<int>{ 1 } };
+    tuplex::tuple<tuplex::tuple<char, double>, tuplex::tuple<short>> t10{ tuplex::tuple<char, double>{ 'a', 1.0 }, tuplex::tuple<short>{ short{ 1 } } };
+    tuplex::tuple<char, tuplex::tuple<>, tuplex::tuple<tuplex::tuple<int>>> t11{ 'a', tuplex::tuple<>{}, tuplex::tuple<tuplex::tuple<int>>{ tuplex::tuple<int>{ 1 } } };
+    tuplex::tuple<holds_tuple> t12{ holds_tuple{ tuplex::tuple<int>{ 1 }, 2 } };
+    tuplex::tuple<char, std::array<tuplex::tuple<char>, 3>> t13{ 'a', std::array<tuplex::tuple<char>, 3>{ 
+        tuplex::tuple<char>{ 'b' }, tuplex::tuple<char>{ 'c' }, tuplex::tuple<char>{ 'd' } } };
+    tuplex::tuple<char, std::pair<tuplex::tuple<char>, char>> t14{ 'a', std::pair<tuplex::tuple<char>, char>{ tuplex::tuple<char>{ 'b' }, 'c' } };
+
+    ASSERT_TRUE(offsets_match(t1, std::make_index_sequence<3>{}));
+    ASSERT_TRUE(offsets_match(t2, std::make_index_sequence<3>{}));
+    ASSERT_TRUE(offsets_match(t3, std::make_index_sequence<3>{}));
+    ASSERT_TRUE(offsets_match(t4, std::make_index_sequence<3>{}));
+    ASSERT_TRUE(offsets_match(t5, std::make_index_sequence<4>{}));
+    ASSERT_TRUE(offsets_match(t6, std::make_index_sequence<1>{}));
+    ASSERT_TRUE(offsets_match(t8, std::make_index_sequence<1>{}));
+    ASSERT_TRUE(offsets_match(t9, std::make_index_sequence<2>{}));
+    ASSERT_TRUE(offsets_match(t10, std::make_index_sequence<2>{}));
+    ASSERT_TRUE(offsets_match(t11, std::make_index_sequence<3>{}));
+    ASSERT_TRUE(offsets_match(t12, std::make_index_sequence<1>{}));
+    ASSERT_TRUE(offsets_match(t13, std::make_index_sequence<2>{}));
+    ASSERT_TRUE(offsets_match(t14, std::make_index_sequence<2>{}));
+
+    static_assert(tuplex::layout_of<decltype(t9)>::padding == sizeof(t9) - sizeof(double) - sizeof(tuplex::tuple<int>));
+
+    // get on a reference element yields the referee, only the elements placed after it are checked
+    ASSERT_TRUE(offsets_match(t7, std::index_sequence<0, 1>{}));
+}
+
+TEST(tuplex_layout, sizes_and_padding)
+{
+    using layout = tuplex::layout_of<tuplex::tuple<char, int, char>>;
+
+    static_assert(layout::size == sizeof(tuplex::tuple<char, int, char>));
+    static_assert(layout::alignment == alignof(int));
+    static_assert(layout::padding == layout::size - 2 * sizeof(char) - sizeof(int));
+
+    static_assert(layout::elements[1].size == sizeof(int));
+    static_assert(layout::elements[1].alignment == alignof(int));
+
+    using refs = tuplex::layout_of<tuplex::tuple<int&, const double&>>;
+
+    static_assert(refs::elements[0].size == sizeof(int*));
+    static_assert(refs::elements[1].size == sizeof(double*));
+    static_assert(refs::padding == refs::size - sizeof(int*) - sizeof(double*));
+}
+
+TEST(tuplex_layout, cache_lines)
+{
+    using crossing = tuplex::layout_of<tuplex::tuple<char, std::array<char, 100>>>;
+
+    static_assert(crossing::elements[1].crosses_cache_line);
+    static_assert(!crossing::elements[0].crosses_cache_line);
+    static_assert(crossing::cache_line_crossings == 1);
+
+    using packed = tuplex::layout_of<tuplex::tuple<double, double, double>>;
+    static_assert(packed::cache_line_crossings == 0);
+
+    using small_lines = tuplex::layout_of<tuplex::tuple<std::array<char, 12>, int>, 8>;
+    static_assert(small_lines::cache_line == 8);
+    static_assert(small_lines::elements[0].crosses_cache_line);
+}
+
+TEST(tuplex_layout, max_padding)
+{
+    static_assert(tuplex::max_padding<tuplex::tuple<char, char, int>, 2>);
+    static_assert(!tuplex::max_padding<tuplex::tuple<char, int, char>, 2>);
+    static_assert(tuplex::max_padding<const tuplex::tuple<int, int>, 0>);
+
+    static_assert([]<tuplex::max_padding<0> Record>() { return true; }.template operator()<tuplex::tuple<int, float>>());
+}
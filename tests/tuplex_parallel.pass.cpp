@@ -0,0 +1,171 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "../headers/tuplex.hpp"
+#include "../headers/tuplex_utils.hpp"
+#include "../headers/tuplex_parallel.hpp"
+
+#include "utils/test_utils.hpp"
+
+TEST(tuplex_parallel, for_each_visits_every_element)
+{
+    tuplex::thread_pool pool{ 4 };
+    tuplex::tuple<int, double, std::string> tp{ 1, 2.5, "ab" };
+
+    tuplex::parallel_for_each(tp, [](auto& value) { value = value + value; }, pool);
+
+    ASSERT_EQ(tuplex::get<0>(tp), 2);
+    ASSERT_EQ(tuplex::get<1>(tp), 5.0);
+    ASSERT_EQ(tuplex::get<2>(tp), "abab");
+}
+
+TEST(tuplex_parallel, for_each_cv_ref)
+{
+    using namespace test_utils;
+
+    for_cv_ref([]<CV_REF type>() -> void
+    {
+        tuplex::thread_pool pool{ 2 };
+        tuplex::tuple<int, float, double> tp{ 1, 2.0f, 3.0 };
+
+        using Tp = decltype(as_t<type>(tp));
+
+        tuplex::parallel_for_each(as_t<type>(tp), []<typename T>(T&&)
+        {
+            using expected = std::conditional_t<std::is_same_v<std::remove_cvref_t<T>, int>, 
+                                                decltype(tuplex::get<0>(std::declval<Tp>())),
+                             std::conditional_t<std::is_same_v<std::remove_cvref_t<T>, float>,
+                                                decltype(tuplex::get<1>(std::declval<Tp>())),
+                                                decltype(tuplex::get<2>(std::declval<Tp>()))>>;
+
+            static_assert(std::is_same_v<T&&, expected>);
+        }, pool);
+    });
+}
+
+TEST(tuplex_parallel, transform)
+{
+    tuplex::thread_pool pool{ 3 };
+    tuplex::tuple<int, std::string, double> tp{ 2, "tuplex", 0.5 };
+
+    auto res{ tuplex::parallel_transform(tp, [](const auto& value)
+    {
+        if constexpr (std::is_same_v<std::remove_cvref_t<decltype(value)>, std::string>)
+        {
+            return value.size();
+        }
+        else
+        {
+            return value * 2;
+        }
+    }, pool) };
+
+    static_assert(std::is_same_v<decltype(res), tuplex::tuple<int, std::size_t, double>>);
+
+    ASSERT_EQ(tuplex::get<0>(res), 4);
+    ASSERT_EQ(tuplex::get<1>(res), 6);
+    ASSERT_EQ(tuplex::get<2>(res), 1.0);
+}
+
+TEST(tuplex_parallel, transform_references)
+{
+    tuplex::tuple<int, float> tp{ 1, 2.0f };
+
+    auto res{ tuplex::parallel_transform(tp, [](auto& value) -> auto& { return value; }) };
+
+    static_assert(std::is_same_v<decltype(res), tuplex::tuple<int&, float&>>);
+
+    ASSERT_EQ(&tuplex::get<0>(res), &tuplex::get<0>(tp));
+    ASSERT_EQ(&tuplex::get<1>(res), &tuplex::get<1>(tp));
+}
+
+TEST(tuplex_parallel, transform_moves_result_once)
+{
+    using namespace test_utils;
+
+    tuplex::tuple<int, int> tp{ 1, 2 };
+
+    auto res{ tuplex::parallel_transform(tp, [](int) { return cm_counter{}; }) };
+
+    cm_counter expected{};
+    cm_counter moved{ std::move(expected) };
+
+    ASSERT_EQ(tuplex::get<0>(res), moved);
+    ASSERT_EQ(tuplex::get<1>(res), moved);
+}
+
+TEST(tuplex_parallel, runs_concurrently)
+{
+    tuplex::thread_pool pool{ 3 };
+    std::atomic<int> arrived{};
+
+    // every element waits for all the others, finishes only if they all run at the same time
+    tuplex::parallel_for_each(tuplex::tuple<int, int, int>{ 0, 0, 0 }, [&](int)
+    {
+        arrived.fetch_add(1);
+        while (arrived.load() != 3)
+        {
+            std::this_thread::yield();
+        }
+    }, pool);
+
+    ASSERT_EQ(arrived.load(), 3);
+}
+
+TEST(tuplex_parallel, rethrows)
+{
+    tuplex::tuple<int, int> tp{ 1, 2 };
+
+    ASSERT_THROW(tuplex::parallel_for_each(tp, [](int value)
+    {
+        if (value == 2)
+        {
+            throw std::runtime_error{ "parallel" };
+        }
+    }), std::runtime_error);
+}
+
+TEST(tuplex_parallel, transform_rethrows_from_result_move)
+{
+    struct throwing_move
+    {
+        throwing_move() = default;
+
+        throwing_move(throwing_move&&)
+        {
+            throw std::runtime_error{ "move" };
+        }
+    };
+
+    tuplex::tuple<int, int> tp{ 1, 2 };
+
+    ASSERT_THROW(static_cast<void>(tuplex::parallel_transform(tp, [](int) { return throwing_move{}; })), std::runtime_error);
+}
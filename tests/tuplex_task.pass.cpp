@@ -0,0 +1,265 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "../headers/tuplex.hpp"
+#include "../headers/tuplex_utils.hpp"
+#include "../headers/tuplex_task.hpp"
+
+#include "utils/test_utils.hpp"
+
+namespace
+{
+    tuplex::task<int> answer()
+    {
+        co_return 42;
+    }
+
+    tuplex::task<std::string> greet(std::string name)
+    {
+        co_return "hello " + name;
+    }
+
+    tuplex::task<int&> ref_to(int& value)
+    {
+        co_return value;
+    }
+
+    tuplex::task<std::unique_ptr<int>> boxed(int value)
+    {
+        co_return std::make_unique<int>(value);
+    }
+
+    tuplex::task<test_utils::cm_counter> counted()
+    {
+        co_return test_utils::cm_counter{};
+    }
+
+    tuplex::task<int> fails()
+    {
+        throw std::runtime_error{ "fails" };
+        co_return 0;
+    }
+
+    tuplex::task<int> arena_answer(std::allocator_arg_t, std::pmr::memory_resource*)
+    {
+        co_return 42;
+    }
+
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{};
+        std::size_t deallocations{};
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override
+        {
+            return this == &rhs;
+        }
+    };
+
+    // forwards to a thread_pool and fails the submit with index fail_at
+    class failing_pool
+    {
+    public:
+        explicit failing_pool(tuplex::thread_pool& pool, std::size_t fail_at) :
+            mPool{ pool }, mFailAt{ fail_at }
+        { }
+
+        void submit(tuplex::thread_pool::job* j)
+        {
+            if (mSubmits++ == mFailAt)
+            {
+                throw std::runtime_error{ "submit" };
+            }
+
+            mPool.submit(j);
+        }
+
+    private:
+        tuplex::thread_pool& mPool;
+        std::size_t mFailAt;
+        std::size_t mSubmits{};
+    };
+
+    tuplex::task<int> slow_answer(std::atomic<int>& started)
+    {
+        started.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 10 });
+        co_return 42;
+    }
+}
+
+TEST(tuplex_task, sync_wait_value)
+{
+    ASSERT_EQ(tuplex::sync_wait(answer()), 42);
+    ASSERT_EQ(tuplex::sync_wait(greet("world")), "hello world");
+}
+
+TEST(tuplex_task, co_await_task)
+{
+    auto outer{ []() -> tuplex::task<int> { co_return co_await answer() + 1; } };
+    ASSERT_EQ(tuplex::sync_wait(outer()), 43);
+}
+
+TEST(tuplex_task, when_all_heterogeneous)
+{
+    int value{ 7 };
+
+    auto outer{ [&]() -> tuplex::task<tuplex::tuple<int, std::string, int&, std::unique_ptr<int>>>
+    {
+        co_return co_await tuplex::when_all(answer(), greet("tuplex"), ref_to(value), boxed(5));
+    } };
+
+    auto res{ tuplex::sync_wait(outer()) };
+
+    static_assert(std::is_same_v<decltype(res), tuplex::tuple<int, std::string, int&, std::unique_ptr<int>>>);
+
+    ASSERT_EQ(tuplex::get<0>(res), 42);
+    ASSERT_EQ(tuplex::get<1>(res), "hello tuplex");
+    ASSERT_EQ(&tuplex::get<2>(res), &value);
+    ASSERT_EQ(*tuplex::get<3>(res), 5);
+}
+
+TEST(tuplex_task, when_all_never_copies_result)
+{
+    tuplex::thread_pool pool{ 2 };
+
+    auto outer{ [&]() -> tuplex::task<int>
+    {
+        auto res{ co_await tuplex::when_all(pool, counted()) };
+
+        // co_return into the child frame, then into the tuple
+        test_utils::cm_counter expected{};
+        test_utils::cm_counter into_frame{ std::move(expected) };
+        test_utils::cm_counter into_tuple{ std::move(into_frame) };
+
+        co_return tuplex::get<0>(res) == into_tuple ? 1 : 0;
+    } };
+
+    ASSERT_EQ(tuplex::sync_wait(outer()), 1);
+}
+
+TEST(tuplex_task, when_all_many)
+{
+    tuplex::thread_pool pool{ 4 };
+
+    auto outer{ [&]() -> tuplex::task<int>
+    {
+        auto res{ co_await tuplex::when_all(pool, answer(), answer(), answer(), answer(),
+                                                  answer(), answer(), answer(), answer()) };
+
+        co_return tuplex::get<0>(res) + tuplex::get<7>(res);
+    } };
+
+    for (int i{}; i < 100; ++i)
+    {
+        ASSERT_EQ(tuplex::sync_wait(outer()), 84);
+    }
+}
+
+TEST(tuplex_task, when_all_rethrows)
+{
+    auto outer{ []() -> tuplex::task<int>
+    {
+        auto res{ co_await tuplex::when_all(answer(), fails()) };
+        co_return tuplex::get<0>(res);
+    } };
+
+    ASSERT_THROW(tuplex::sync_wait(outer()), std::runtime_error);
+}
+
+TEST(tuplex_task, when_all_rethrows_submit_error)
+{
+    tuplex::thread_pool pool{ 2 };
+
+    for (std::size_t fail_at{}; fail_at < 4; ++fail_at)
+    {
+        std::atomic<int> started{};
+        failing_pool failing{ pool, fail_at };
+
+        // the children submitted before the failure still run, the awaiter resumes after the last of them
+        auto outer{ [&]() -> tuplex::task<int>
+        {
+            auto res{ co_await tuplex::when_all(failing, slow_answer(started), slow_answer(started),
+                                                slow_answer(started), slow_answer(started)) };
+            co_return tuplex::get<0>(res);
+        } };
+
+        ASSERT_THROW(tuplex::sync_wait(outer()), std::runtime_error);
+        ASSERT_EQ(started.load(), static_cast<int>(fail_at));
+    }
+}
+
+TEST(tuplex_task, arena_frames)
+{
+    counting_resource resource{};
+
+    {
+        std::array<std::byte, 4096> buffer{};
+        std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), &resource };
+
+        auto outer{ [&]() -> tuplex::task<int>
+        {
+            auto res{ co_await tuplex::when_all(arena_answer(std::allocator_arg, &arena),
+                                                arena_answer(std::allocator_arg, &arena)) };
+            co_return tuplex::get<0>(res) + tuplex::get<1>(res);
+        } };
+
+        ASSERT_EQ(tuplex::sync_wait(outer()), 84);
+    }
+
+    // both frames fit the buffer, the upstream resource is never touched
+    ASSERT_EQ(resource.allocations, 0);
+
+    {
+        auto t{ arena_answer(std::allocator_arg, &resource) };
+        ASSERT_EQ(resource.allocations, 1);
+        ASSERT_EQ(tuplex::sync_wait(std::move(t)), 42);
+    }
+
+    ASSERT_EQ(resource.deallocations, 1);
+}
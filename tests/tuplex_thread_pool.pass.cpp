@@ -0,0 +1,76 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "../headers/tuplex_thread_pool.hpp"
+
+namespace
+{
+    struct counting_job : tuplex::thread_pool::job
+    {
+        std::atomic<std::size_t>* counter;
+
+        static void run_fn(tuplex::thread_pool::job* j) noexcept
+        {
+            static_cast<counting_job*>(j)->counter->fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+}
+
+TEST(tuplex_thread_pool, runs_every_job)
+{
+    std::atomic<std::size_t> counter{};
+    std::vector<counting_job> jobs(1000, counting_job{ { &counting_job::run_fn }, &counter });
+
+    {
+        tuplex::thread_pool pool{ 4 };
+        ASSERT_EQ(pool.size(), 4);
+
+        for (auto& j : jobs)
+        {
+            pool.submit(&j);
+        }
+    }
+
+    ASSERT_EQ(counter.load(), jobs.size());
+}
+
+TEST(tuplex_thread_pool, caller_helps)
+{
+    std::atomic<std::size_t> counter{};
+    counting_job j{ { &counting_job::run_fn }, &counter };
+
+    tuplex::thread_pool pool{ 1 };
+    pool.submit(&j);
+
+    while (counter.load() == 0)
+    {
+        pool.try_run_one();
+    }
+
+    ASSERT_EQ(counter.load(), 1);
+}
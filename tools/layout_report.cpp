@@ -0,0 +1,102 @@
+// MIT License
+// 
+// Copyright (c) 2025 Mr. Myxa
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "tuplex.hpp"
+#include "tuplex_utils.hpp"
+#include "tuplex_layout.hpp"
+
+// prints tuplex::layout_of for the types listed in main()
+//
+// usage: layout_report [--max-padding N]
+//        with --max-padding exits with 1 when a listed type wastes more than N bytes
+//        exits with 2 on a malformed command line
+
+namespace
+{
+    template <typename Tuple>
+    bool report(std::string_view name, std::size_t max_padding)
+    {
+        using layout = tuplex::layout_of<Tuple>;
+
+        std::cout << std::format("{}\n  size {}, alignment {}, padding {}, cache line crossings {}\n",
+                                 name, layout::size, layout::alignment, layout::padding, layout::cache_line_crossings);
+        std::cout << std::format("  {:>5} {:>8} {:>8} {:>8}\n", "index", "offset", "size", "align");
+
+        for (const auto& element : layout::elements)
+        {
+            std::cout << std::format("  {:>5} {:>8} {:>8} {:>8}{}\n", element.index, element.offset, element.size, element.alignment,
+                                     element.crosses_cache_line ? "  crosses cache line" : "");
+        }
+
+        if (layout::padding > max_padding)
+        {
+            std::cout << std::format("  padding {} exceeds {}\n", layout::padding, max_padding);
+            return false;
+        }
+
+        return true;
+    }
+
+    bool parse_size(std::string_view text, std::size_t& value)
+    {
+        const auto* const last{ text.data() + text.size() };
+        const auto [ptr, ec]{ std::from_chars(text.data(), last, value) };
+        return !text.empty() && ec == std::errc{} && ptr == last;
+    }
+
+    int usage()
+    {
+        std::cerr << "usage: layout_report [--max-padding N]\n";
+        return 2;
+    }
+}
+
+#define LAYOUT_REPORT(...) ok = report<__VA_ARGS__>(#__VA_ARGS__, max_padding) && ok
+
+int main(int argc, char** argv)
+{
+    std::size_t max_padding{ SIZE_MAX };
+
+    if (argc != 1 && (argc != 3 || std::string_view{ argv[1] } != "--max-padding" || !parse_size(argv[2], max_padding)))
+    {
+        return usage();
+    }
+
+    bool ok{ true };
+
+    LAYOUT_REPORT(tuplex::tuple<char, int, char>);
+    LAYOUT_REPORT(tuplex::tuple<char, char, int>);
+    LAYOUT_REPORT(tuplex::tuple<std::uint8_t, double, std::uint16_t, float>);
+    LAYOUT_REPORT(tuplex::tuple<std::string, std::uint32_t, bool>);
+    LAYOUT_REPORT(tuplex::tuple<char, std::array<char, 100>, long long>);
+
+    return ok ? 0 : 1;
+}